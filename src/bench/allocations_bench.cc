@@ -0,0 +1,101 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file allocations_bench.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Counts heap allocations of typical small-matrix workloads.
+ *
+ * @details Replaces the global allocation functions with counting ones and
+ * runs the same sequence of operations for sizes on both sides of the
+ * inline buffer limit (16 elements): up to 4x4 nothing should allocate,
+ * larger sizes allocate nothing either once the buffer pool is enabled.
+ * Then streams rows into a matrix, where the allocations should grow with
+ * the logarithm of the row count.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "../s21_buffer_pool.h"
+#include "../s21_matrix_oop.h"
+#include "counting_new.h"
+
+namespace {
+
+/**
+ * One iteration: construct, copy, add, scale, multiply and transpose.
+ */
+double Workload(int n, int seed) {
+  S21::S21Matrix a(n, n), b(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      a(i, j) = (i + 1) * (j + seed % 7 + 1);
+      b(i, j) = i == j ? 2.0 : 0.5;
+    }
+  }
+  S21::S21Matrix c = a + b;
+  c -= a * 0.5;
+  c *= b;
+  S21::S21Matrix t = c.Transpose();
+  return t(n - 1, 0) + c(0, n - 1);
+}
+
+/**
+ * Appends rows of cols elements one at a time, the streaming ingestion
+ * pattern.
+ */
+double Stream(int rows, int cols) {
+  S21::S21Matrix m;
+  std::vector<double> row(cols);
+  for (int i = 0; i < rows; ++i) {
+    row[i % cols] = i;
+    m.AppendRow(S21::S21Span<const double>(row.data(), cols));
+  }
+  return m(rows - 1, 0);
+}
+
+}  // namespace
+
+int main() {
+  constexpr int kIterations = 200000;
+  std::printf("%6s %10s %5s %18s %12s\n", "size", "elements", "pool",
+              "allocs/iteration", "ns/iteration");
+  volatile double sink = 0;
+  for (const int n : {2, 3, 4, 5, 8, 32}) {
+    for (const bool pool : {false, true}) {
+      S21::SetBufferPoolEnabled(pool);
+      sink = sink + Workload(n, 0);  // fills the pool
+      bench::allocations.store(0);
+      const auto start = std::chrono::steady_clock::now();
+      for (int it = 0; it < kIterations; ++it) {
+        sink = sink + Workload(n, it);
+      }
+      const std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+      std::printf("%3dx%-2d %10d %5s %18.2f %12.1f\n", n, n, n * n,
+                  pool ? "on" : "off",
+                  static_cast<double>(bench::allocations.load()) / kIterations,
+                  elapsed.count() / kIterations);
+    }
+  }
+  S21::SetBufferPoolEnabled(false);
+
+  std::printf("\n%8s %6s %8s %10s\n", "rows", "cols", "allocs", "ms");
+  for (const int rows : {1000, 10000, 100000}) {
+    bench::allocations.store(0);
+    const auto start = std::chrono::steady_clock::now();
+    sink = sink + Stream(rows, 16);
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::printf("%8d %6d %8ld %10.2f\n", rows, 16,
+                static_cast<long>(bench::allocations.load()), elapsed.count());
+  }
+  return 0;
+}
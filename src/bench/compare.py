@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Copyright 2024 Dmitrii Khramtsov
+"""Compares two Google Benchmark JSON files of bench/matrix_bench.cc.
+
+Every benchmark should have been run with --benchmark_repetitions=N. For
+each one present in both files the medians of the repetitions are compared
+and a bootstrap confidence interval of the ratio of the medians is computed.
+A benchmark regresses when its median is slower than the baseline by more
+than the threshold and the whole interval lies above 1, i.e. the slowdown
+is both large and not noise. A benchmark of the baseline missing from the
+contender fails too, as a removed or crashed benchmark would otherwise hide
+its regression; --allow-missing only reports it. The exit status is 1 when
+anything regresses or is missing.
+
+Usage: compare.py BASELINE CONTENDER [--threshold 0.10] [--confidence 0.95]
+                  [--allow-missing]
+"""
+
+import argparse
+import json
+import random
+import statistics
+import sys
+
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+BOOTSTRAP_SAMPLES = 2000
+
+
+def load(path, metric, order):
+    """Returns {benchmark name: [times of the repetitions in ns]} and fills
+    order with the position of each benchmark in the suite."""
+    with open(path, encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+    samples, medians = {}, {}
+    for bench in benchmarks:
+        name = bench.get("run_name", bench["name"])
+        order.setdefault(name, (bench.get("family_index", 0),
+                                bench.get("per_family_instance_index", 0)))
+        time = bench[metric] * TIME_UNITS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            # Runs with --benchmark_report_aggregates_only keep the median
+            if bench.get("aggregate_name") == "median":
+                medians[name] = [time]
+        else:
+            samples.setdefault(name, []).append(time)
+    for name, median in medians.items():
+        samples.setdefault(name, median)
+    return samples
+
+
+def ratio_interval(base, new, confidence, rng):
+    """Bootstrap interval of median(new) / median(base)."""
+    if len(base) < 2 or len(new) < 2:
+        ratio = statistics.median(new) / statistics.median(base)
+        return ratio, ratio
+    ratios = sorted(
+        statistics.median(rng.choices(new, k=len(new))) /
+        statistics.median(rng.choices(base, k=len(base)))
+        for _ in range(BOOTSTRAP_SAMPLES))
+    tail = (1.0 - confidence) / 2.0
+    low = ratios[int(tail * (BOOTSTRAP_SAMPLES - 1))]
+    high = ratios[int((1.0 - tail) * (BOOTSTRAP_SAMPLES - 1))]
+    return low, high
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.3g %s" % (ns / scale, unit)
+    return "%.3g ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="tolerated slowdown, 0.10 is 10%%")
+    parser.add_argument("--confidence", type=float, default=0.95,
+                        help="level of the bootstrap interval")
+    parser.add_argument("--metric", default="real_time",
+                        choices=("real_time", "cpu_time"))
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="do not fail on baseline benchmarks missing "
+                        "from the contender")
+    args = parser.parse_args()
+
+    order = {}
+    base = load(args.baseline, args.metric, order)
+    new = load(args.contender, args.metric, order)
+    rng = random.Random(0)  # the same interval for the same inputs
+
+    print("%-36s %10s %10s %8s %17s  %s" %
+          ("benchmark", "baseline", "contender", "change", "interval",
+           "status"))
+    regressions = []
+    for name in sorted(set(base) & set(new), key=order.get):
+        ratio = statistics.median(new[name]) / statistics.median(base[name])
+        low, high = ratio_interval(base[name], new[name], args.confidence, rng)
+        if ratio > 1.0 + args.threshold and low > 1.0:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif ratio < 1.0 - args.threshold and high < 1.0:
+            status = "faster"
+        else:
+            status = "ok"
+        print("%-36s %10s %10s %+7.1f%% [%+6.1f%%, %+6.1f%%]  %s" %
+              (name, format_time(statistics.median(base[name])),
+               format_time(statistics.median(new[name])),
+               (ratio - 1.0) * 100, (low - 1.0) * 100, (high - 1.0) * 100,
+               status))
+
+    missing = sorted(set(base) - set(new))
+    for name in missing:
+        print("%-36s missing from the contender" % name)
+    for name in sorted(set(new) - set(base)):
+        print("%-36s not in the baseline" % name)
+
+    failed = False
+    if regressions:
+        print("\n%d benchmark(s) slower than the baseline by more than %g%%:"
+              % (len(regressions), args.threshold * 100))
+        for name in regressions:
+            print("  " + name)
+        failed = True
+    if missing and not args.allow_missing:
+        print("\n%d benchmark(s) of the baseline missing from the contender,"
+              " pass --allow-missing to accept:" % len(missing))
+        for name in missing:
+            print("  " + name)
+        failed = True
+    if failed:
+        return 1
+    print("\nNo regression beyond %g%%." % (args.threshold * 100))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,69 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file counting_new.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Replacement global allocation functions counting heap allocations.
+ *
+ * @details Include from exactly one translation unit of a benchmark program.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_BENCH_COUNTING_NEW_H_
+#define CPP1_S21_MATRIXPLUS_BENCH_COUNTING_NEW_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace bench {
+
+inline std::atomic<long long> allocations{0};
+
+inline void* CountedAlloc(std::size_t size, std::size_t alignment) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (alignment <= alignof(std::max_align_t)) {
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  } else {
+    size = (size + alignment - 1) / alignment * alignment;
+    if (void* ptr = std::aligned_alloc(alignment, size ? size : alignment)) {
+      return ptr;
+    }
+  }
+  throw std::bad_alloc();
+}
+
+}  // namespace bench
+
+void* operator new(std::size_t size) { return bench::CountedAlloc(size, 0); }
+void* operator new[](std::size_t size) {
+  return bench::CountedAlloc(size, 0);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return bench::CountedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return bench::CountedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_BENCH_COUNTING_NEW_H_
@@ -0,0 +1,102 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file expression_bench.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Compares D = A + B - C * 2.0 and D = A * B + C evaluated through the
+ * lazy expressions with the same chains built from eager temporaries.
+ *
+ * @details The eager variants reproduce what the operators did before the
+ * expressions: copy A and add B, copy C and scale it, subtract, then assign,
+ * i.e. three allocations and five passes over memory. The lazy variant reads
+ * A, B and C once and writes D once. For A * B + C the sum is written into
+ * the buffer of the product instead of a copy of it.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "../s21_matrix_oop.h"
+#include "counting_new.h"
+
+namespace {
+
+S21::S21Matrix Filled(int n, double shift) {
+  S21::S21Matrix matrix(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      matrix(i, j) = (i * 3 + j) % 17 + shift;
+    }
+  }
+  return matrix;
+}
+
+void Eager(const S21::S21Matrix& a, const S21::S21Matrix& b,
+           const S21::S21Matrix& c, S21::S21Matrix& d) {
+  S21::S21Matrix sum(a);
+  sum.SumMatrix(b);
+  S21::S21Matrix scaled(c);
+  scaled.MulNumber(2.0);
+  S21::S21Matrix difference(sum);
+  difference.SubMatrix(scaled);
+  d = std::move(difference);
+}
+
+void Lazy(const S21::S21Matrix& a, const S21::S21Matrix& b,
+          const S21::S21Matrix& c, S21::S21Matrix& d) {
+  d = a + b - c * 2.0;
+}
+
+void EagerProduct(const S21::S21Matrix& a, const S21::S21Matrix& b,
+                  const S21::S21Matrix& c, S21::S21Matrix& d) {
+  const S21::S21Matrix product = a * b;
+  S21::S21Matrix sum(product);
+  sum.SumMatrix(c);
+  d = std::move(sum);
+}
+
+void LazyProduct(const S21::S21Matrix& a, const S21::S21Matrix& b,
+                 const S21::S21Matrix& c, S21::S21Matrix& d) {
+  S21::S21Matrix sum = a * b + c;
+  d = std::move(sum);
+}
+
+template <class Chain>
+void Run(const char* name, int n, Chain chain) {
+  const S21::S21Matrix a = Filled(n, 1.0), b = Filled(n, 2.0),
+                       c = Filled(n, 0.5);
+  S21::S21Matrix d(n, n);
+  const int iterations = n <= 64 ? 20000 : 20000000 / (n * n) + 1;
+  bench::allocations.store(0);
+  const auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    chain(a, b, c, d);
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::printf("%-13s %6d %18.2f %14.1f\n", name, n,
+              static_cast<double>(bench::allocations.load()) / iterations,
+              elapsed.count() / iterations);
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-13s %6s %18s %14s\n", "chain", "size", "allocs/iteration",
+              "ns/iteration");
+  for (const int n : {8, 64, 512, 2048}) {
+    Run("eager", n, Eager);
+    Run("lazy", n, Lazy);
+  }
+  for (const int n : {8, 64, 512}) {
+    Run("eager_product", n, EagerProduct);
+    Run("lazy_product", n, LazyProduct);
+  }
+  return 0;
+}
@@ -0,0 +1,576 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file matrix_bench.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Google Benchmark suite of the public S21Matrix operations.
+ *
+ * @details Every operation runs on n x n matrices, n = 2, 4, ..., 4096, and
+ * reports wall time, GFLOP/s (the FLOPS counter, from the nominal flop
+ * counts listed next to each benchmark) and bytes/s (bytes the operation has
+ * to read and write at least). The library is multithreaded, so times are
+ * real, not CPU, times.
+ * `make bench` writes the results to bench_results.json; the usual
+ * --benchmark_filter and --benchmark_repetitions flags go in BENCH_FLAGS.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_lu.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_sparse_matrix.h"
+
+namespace {
+
+constexpr int kMinSize = 2;
+constexpr int kMaxSize = 4096;
+// Stored elements per row of the sparse matrices, before duplicates merge
+constexpr int kSparsePerRow = 8;
+
+/**
+ * Well-conditioned n x n matrix: small pseudo-random entries and a dominant
+ * diagonal, so that it is invertible at every size.
+ */
+S21::S21Matrix Filled(int n, unsigned seed) {
+  S21::S21Matrix matrix(n, n);
+  unsigned state = seed * 2654435761u + 1;
+  for (int i = 0; i < n; ++i) {
+    double* row = matrix.RowPtr(i);
+    for (int j = 0; j < n; ++j) {
+      state = state * 1664525u + 1013904223u;
+      row[j] = static_cast<double>(state >> 8) / (1u << 24) - 0.5;
+    }
+    row[i] += n;
+  }
+  return matrix;
+}
+
+/**
+ * Cyclic permutation matrix: multiplying by it keeps the magnitudes, so a
+ * matrix can be multiplied in place over and over.
+ */
+S21::S21Matrix Shift(int n) {
+  S21::S21Matrix matrix(n, n);
+  for (int i = 0; i < n; ++i) {
+    matrix(i, (i + 1) % n) = 1.0;
+  }
+  return matrix;
+}
+
+/**
+ * Sparse n x n matrix with kSparsePerRow non-zeros in every row, at
+ * pseudo-random columns, the same values as Filled where they are stored.
+ */
+S21::S21SparseMatrix SparseFilled(int n, unsigned seed) {
+  std::vector<S21::S21Triplet> triplets;
+  unsigned state = seed * 2654435761u + 1;
+  for (int i = 0; i < n; ++i) {
+    triplets.push_back({i, i, static_cast<double>(n)});
+    for (int k = 1; k < kSparsePerRow; ++k) {
+      state = state * 1664525u + 1013904223u;
+      triplets.push_back({i, static_cast<int>((state >> 8) % n), 0.5});
+    }
+  }
+  return S21::S21SparseMatrix(n, n, triplets);
+}
+
+double Cube(double n) { return n * n * n; }
+
+/**
+ * Sets the throughput counters from the work of one iteration.
+ */
+void Report(benchmark::State& state, double flops, double bytes) {
+  if (flops > 0) {
+    // Printed as FLOPS=12.3G/s; flop/s in the JSON output
+    state.counters["FLOPS"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+void Sizes(benchmark::internal::Benchmark* bench) {
+  bench->RangeMultiplier(2)->Range(kMinSize, kMaxSize)->UseRealTime();
+}
+
+/****** CONSTRUCTORS AND ASSIGNMENT ******/
+
+void BM_Construct(benchmark::State& state) {
+  const int n = state.range(0);
+  for (auto _ : state) {
+    S21::S21Matrix matrix(n, n);
+    benchmark::DoNotOptimize(matrix.data());
+  }
+  Report(state, 0, 8.0 * n * n);
+}
+BENCHMARK(BM_Construct)->Apply(Sizes);
+
+void BM_Copy(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix copy(a);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  Report(state, 0, 16.0 * n * n);
+}
+BENCHMARK(BM_Copy)->Apply(Sizes);
+
+void BM_Move(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix moved(std::move(a));
+    a = std::move(moved);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 0, 0);
+}
+BENCHMARK(BM_Move)->Apply(Sizes);
+
+/****** MAIN METHODS ******/
+
+void BM_EqMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = a;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.EqMatrix(b));
+  }
+  Report(state, n * n, 16.0 * n * n);
+}
+BENCHMARK(BM_EqMatrix)->Apply(Sizes);
+
+// n^2 flops, read two matrices and write one
+void BM_SumMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, n * n, 24.0 * n * n);
+}
+BENCHMARK(BM_SumMatrix)->Apply(Sizes);
+
+void BM_SubMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    a.SubMatrix(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, n * n, 24.0 * n * n);
+}
+BENCHMARK(BM_SubMatrix)->Apply(Sizes);
+
+void BM_MulNumber(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  double num = 1.0;
+  for (auto _ : state) {
+    a.MulNumber(num);
+    num = -num;
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, n * n, 16.0 * n * n);
+}
+BENCHMARK(BM_MulNumber)->Apply(Sizes);
+
+// 2 n^3 flops
+void BM_MulMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = Shift(n);
+  for (auto _ : state) {
+    a.MulMatrix(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 2 * Cube(n), 24.0 * n * n);
+}
+BENCHMARK(BM_MulMatrix)->Apply(Sizes);
+
+// 2 n^3 flops in single precision: twice the lanes per register and half
+// the bytes of BM_MulMatrix
+void BM_MulMatrixFloat(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::BasicMatrix<float> a(Filled(n, 1));
+  const S21::BasicMatrix<float> b(Shift(n));
+  for (auto _ : state) {
+    a.MulMatrix(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 2 * Cube(n), 12.0 * n * n);
+}
+BENCHMARK(BM_MulMatrixFloat)->Apply(Sizes);
+
+// 8 n^3 real flops: four real multiply-adds per complex one
+void BM_MulMatrixComplex(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21ComplexMatrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) a(i, j) = {0.5, -0.25};
+  }
+  const S21::S21ComplexMatrix b(Shift(n));
+  for (auto _ : state) {
+    a.MulMatrix(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 8 * Cube(n), 48.0 * n * n);
+}
+BENCHMARK(BM_MulMatrixComplex)->Apply(Sizes);
+
+// The 3M method does 6 n^3 real flops; FLOPS counts the 8 n^3 of the
+// classic product, so it compares directly with BM_MulMatrixComplex
+void BM_MulMatrixComplex3M(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21MulPolicy policy;
+  policy.algorithm = S21::S21MulAlgorithm::kComplex3M;
+  S21::S21ComplexMatrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) a(i, j) = {0.5, -0.25};
+  }
+  const S21::S21ComplexMatrix b(Shift(n));
+  for (auto _ : state) {
+    a.MulMatrix(b, policy);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 8 * Cube(n), 48.0 * n * n);
+}
+BENCHMARK(BM_MulMatrixComplex3M)->Apply(Sizes);
+
+// Strassen-Winograd with the default crossover; FLOPS counts the 2 n^3
+// flops of the classic product, so it compares directly with BM_MulMatrix
+void BM_MulMatrixStrassen(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21MulPolicy policy;
+  policy.algorithm = S21::S21MulAlgorithm::kStrassen;
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = Shift(n);
+  for (auto _ : state) {
+    a.MulMatrix(b, policy);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 2 * Cube(n), 24.0 * n * n);
+}
+BENCHMARK(BM_MulMatrixStrassen)
+    ->RangeMultiplier(2)
+    ->Range(512, kMaxSize)
+    ->UseRealTime();
+
+void BM_Transpose(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix t = a.Transpose();
+    benchmark::DoNotOptimize(t.data());
+  }
+  Report(state, 0, 16.0 * n * n);
+}
+BENCHMARK(BM_Transpose)->Apply(Sizes);
+
+void BM_TransposeInPlace(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    a.TransposeInPlace();
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 0, 16.0 * n * n);
+}
+BENCHMARK(BM_TransposeInPlace)->Apply(Sizes);
+
+// 2/3 n^3 flops, the LU factorization
+void BM_Determinant(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.Determinant());
+  }
+  Report(state, 2 * Cube(n) / 3, 16.0 * n * n);
+}
+BENCHMARK(BM_Determinant)->Apply(Sizes);
+
+// 2 n^3 flops, factorization and inversion
+void BM_CalcComplements(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix complements = a.CalcComplements();
+    benchmark::DoNotOptimize(complements.data());
+  }
+  Report(state, 2 * Cube(n), 16.0 * n * n);
+}
+BENCHMARK(BM_CalcComplements)->Apply(Sizes);
+
+void BM_InverseMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix inverse = a.InverseMatrix();
+    benchmark::DoNotOptimize(inverse.data());
+  }
+  Report(state, 2 * Cube(n), 16.0 * n * n);
+}
+BENCHMARK(BM_InverseMatrix)->Apply(Sizes);
+
+// 2 n^2 flops per right-hand side on top of the factorization
+void BM_Solve(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21LU lu(Filled(n, 1));
+  const std::vector<double> b(n, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lu.Solve(b).data());
+  }
+  Report(state, 2.0 * n * n, 8.0 * n * n);
+}
+BENCHMARK(BM_Solve)->Apply(Sizes);
+
+// 2/3 n^3 flops of the factorization and 2 n^2 of the solve
+void BM_FactorSolve(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  const std::vector<double> b(n, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(S21::S21LU(a).Solve(b).data());
+  }
+  Report(state, 2.0 / 3 * Cube(n) + 2.0 * n * n, 16.0 * n * n);
+}
+BENCHMARK(BM_FactorSolve)->Apply(Sizes);
+
+// Same work counted as BM_FactorSolve, factorized in float and refined in
+// double to the same accuracy
+void BM_FactorSolveMixed(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  const std::vector<double> b(n, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(S21::S21MixedLU(a).Solve(b).data());
+  }
+  Report(state, 2.0 / 3 * Cube(n) + 2.0 * n * n, 16.0 * n * n);
+}
+BENCHMARK(BM_FactorSolveMixed)->Apply(Sizes);
+
+/****** GETTERS & SETTERS ******/
+
+void BM_SetRowsCols(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    a.SetRows(n / 2);
+    a.SetCols(n / 2);
+    a.SetRows(n);
+    a.SetCols(n);
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 0, 6.0 * n * n);
+}
+BENCHMARK(BM_SetRowsCols)->Apply(Sizes);
+
+void BM_AppendRow(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix source = Filled(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix matrix;
+    for (int i = 0; i < n; ++i) {
+      matrix.AppendRow(source.RowSpan(i));
+    }
+    benchmark::DoNotOptimize(matrix.data());
+  }
+  Report(state, 0, 16.0 * n * n);
+}
+BENCHMARK(BM_AppendRow)->Apply(Sizes);
+
+/****** OVERLOADED METHODS ******/
+
+// 3 n^2 flops in one pass over four matrices
+void BM_Expression(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1), b = Filled(n, 2), c = Filled(n, 3);
+  S21::S21Matrix d(n, n);
+  for (auto _ : state) {
+    d = a + b - c * 2.0;
+    benchmark::DoNotOptimize(d.data());
+  }
+  Report(state, 3.0 * n * n, 32.0 * n * n);
+}
+BENCHMARK(BM_Expression)->Apply(Sizes);
+
+void BM_Product(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1), b = Filled(n, 2);
+  for (auto _ : state) {
+    S21::S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  Report(state, 2 * Cube(n), 24.0 * n * n);
+}
+BENCHMARK(BM_Product)->Apply(Sizes);
+
+void BM_CompoundAssignment(benchmark::State& state) {
+  const int n = state.range(0);
+  S21::S21Matrix a = Filled(n, 1);
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    a += b;
+    a -= b;
+    a *= 1.0;
+    benchmark::DoNotOptimize(a.data());
+  }
+  Report(state, 3.0 * n * n, 64.0 * n * n);
+}
+BENCHMARK(BM_CompoundAssignment)->Apply(Sizes);
+
+void BM_ElementAccess(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    double sum = 0;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        sum += a(i, j);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  Report(state, n * n, 8.0 * n * n);
+}
+BENCHMARK(BM_ElementAccess)->Apply(Sizes);
+
+void BM_UncheckedAccess(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21Matrix a = Filled(n, 1);
+  for (auto _ : state) {
+    double sum = 0;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        sum += a.At(i, j);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  Report(state, n * n, 8.0 * n * n);
+}
+BENCHMARK(BM_UncheckedAccess)->Apply(Sizes);
+
+/****** SPARSE MATRICES ******/
+
+// The sparse benchmarks count only the flops on stored elements, 2 per
+// multiply-add; their dense counterparts do the same work on a dense copy,
+// with FLOPS counted the same way, so the two compare directly
+
+void BM_SparseMulVector(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix a = SparseFilled(n, 1);
+  const std::vector<double> x(n, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((a * x).data());
+  }
+  Report(state, 2.0 * a.GetNonZeros(), 12.0 * a.GetNonZeros() + 16.0 * n);
+}
+BENCHMARK(BM_SparseMulVector)->Apply(Sizes);
+
+void BM_SparseMulVectorDense(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix sparse = SparseFilled(n, 1);
+  const S21::S21Matrix a = sparse.ToDense();
+  const S21::S21Matrix x(n, 1);
+  for (auto _ : state) {
+    S21::S21Matrix y = a * x;
+    benchmark::DoNotOptimize(y.data());
+  }
+  Report(state, 2.0 * sparse.GetNonZeros(), 8.0 * n * n + 16.0 * n);
+}
+BENCHMARK(BM_SparseMulVectorDense)->Apply(Sizes);
+
+void BM_SparseMulDense(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix a = SparseFilled(n, 1);
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    S21::S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  Report(state, 2.0 * a.GetNonZeros() * n,
+         12.0 * a.GetNonZeros() + 16.0 * n * n);
+}
+BENCHMARK(BM_SparseMulDense)->Apply(Sizes);
+
+void BM_SparseMulDenseLeft(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix a = SparseFilled(n, 1);
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    S21::S21Matrix c = b * a;
+    benchmark::DoNotOptimize(c.data());
+  }
+  Report(state, 2.0 * a.GetNonZeros() * n,
+         12.0 * a.GetNonZeros() + 16.0 * n * n);
+}
+BENCHMARK(BM_SparseMulDenseLeft)->Apply(Sizes);
+
+void BM_SparseMulDenseDense(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix sparse = SparseFilled(n, 1);
+  const S21::S21Matrix a = sparse.ToDense();
+  const S21::S21Matrix b = Filled(n, 2);
+  for (auto _ : state) {
+    S21::S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  Report(state, 2.0 * sparse.GetNonZeros() * n, 24.0 * n * n);
+}
+BENCHMARK(BM_SparseMulDenseDense)->Apply(Sizes);
+
+void BM_SparseSum(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix a = SparseFilled(n, 1);
+  const S21::S21SparseMatrix b = SparseFilled(n, 2);
+  for (auto _ : state) {
+    S21::S21SparseMatrix c = a + b;
+    benchmark::DoNotOptimize(c.GetValues().data());
+  }
+  Report(state, a.GetNonZeros() + b.GetNonZeros(),
+         24.0 * (a.GetNonZeros() + b.GetNonZeros()));
+}
+BENCHMARK(BM_SparseSum)->Apply(Sizes);
+
+void BM_SparseSumDense(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix sparse_a = SparseFilled(n, 1);
+  const S21::S21SparseMatrix sparse_b = SparseFilled(n, 2);
+  const S21::S21Matrix a = sparse_a.ToDense();
+  const S21::S21Matrix b = sparse_b.ToDense();
+  for (auto _ : state) {
+    S21::S21Matrix c = a + b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  Report(state, sparse_a.GetNonZeros() + sparse_b.GetNonZeros(),
+         24.0 * n * n);
+}
+BENCHMARK(BM_SparseSumDense)->Apply(Sizes);
+
+void BM_SparseTranspose(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21::S21SparseMatrix a = SparseFilled(n, 1);
+  for (auto _ : state) {
+    S21::S21SparseMatrix t = a.Transpose();
+    benchmark::DoNotOptimize(t.GetValues().data());
+  }
+  Report(state, 0, 24.0 * a.GetNonZeros());
+}
+BENCHMARK(BM_SparseTranspose)->Apply(Sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
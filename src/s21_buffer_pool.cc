@@ -0,0 +1,224 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_buffer_pool.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Thread-local buffer pool of the CPP1_s21_matrixplus project.
+ *
+ * @details One stateless memory resource serves every thread from that
+ * thread's cache: an array of intrusive free lists, one per size class. All
+ * pooled buffers are plain 64-byte-aligned operator new blocks of their class
+ * size, so a buffer allocated on one thread can be cached by another.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_buffer_pool.h"
+
+#include <atomic>   // std::atomic
+#include <cstdlib>  // std::getenv | std::atoi
+#include <new>      // std::align_val_t
+
+namespace S21 {
+
+namespace {
+
+// Alignment of every pooled buffer, the one S21Matrix asks for
+constexpr std::size_t kAlignment = 64;
+// The smallest class holds 256 bytes; buffers above 4 GiB bypass the pool
+constexpr int kMinClassLog2 = 8;
+constexpr int kMaxClassLog2 = 32;
+constexpr int kClassesPerOctave = 4;
+constexpr int kClasses =
+    (kMaxClassLog2 - kMinClassLog2) * kClassesPerOctave + 1;
+// Bytes a thread keeps at most unless SetBufferPoolCap says otherwise
+constexpr std::size_t kDefaultCap = std::size_t{64} << 20;
+
+struct Block {
+  Block* next;
+};
+
+/**
+ * Returns the size class of a buffer of bytes and sets class_bytes to the
+ * size of the class, or returns -1 when the pool does not handle it.
+ */
+int SizeClass(std::size_t bytes, std::size_t alignment,
+              std::size_t& class_bytes) noexcept {
+  constexpr std::size_t kMinBytes = std::size_t{1} << kMinClassLog2;
+  if (alignment > kAlignment || bytes > (std::size_t{1} << kMaxClassLog2)) {
+    return -1;
+  }
+  if (bytes <= kMinBytes) {
+    class_bytes = kMinBytes;
+    return 0;
+  }
+  int log2 = kMinClassLog2;
+  while ((bytes - 1) >> (log2 + 1)) ++log2;
+  const std::size_t base = std::size_t{1} << log2;
+  const std::size_t step = base / kClassesPerOctave;
+  const std::size_t steps = (bytes - base + step - 1) / step;
+  class_bytes = base + steps * step;
+  return (log2 - kMinClassLog2) * kClassesPerOctave + static_cast<int>(steps);
+}
+
+void Free(void* p) noexcept {
+  ::operator delete(p, std::align_val_t{kAlignment});
+}
+
+struct Cache {
+  Block* free[kClasses] = {};
+  S21BufferPoolStats stats = {};
+
+  ~Cache();
+
+  void Trim() noexcept {
+    for (Block*& head : free) {
+      while (head) {
+        Block* next = head->next;
+        Free(head);
+        head = next;
+      }
+    }
+    stats.bytes_retained = 0;
+    stats.blocks_retained = 0;
+  }
+};
+
+// Set once the cache of the thread is gone, buffers released later by other
+// thread-local objects go straight to operator delete
+thread_local bool tls_cache_destroyed = false;
+thread_local Cache tls_cache;
+
+Cache::~Cache() {
+  Trim();
+  tls_cache_destroyed = true;
+}
+
+std::atomic<std::size_t> cap{kDefaultCap};
+
+std::atomic<bool>& Enabled() noexcept {
+  static std::atomic<bool> enabled{[] {
+    const char* env = std::getenv("S21_BUFFER_POOL");
+    return env && std::atoi(env) != 0;
+  }()};
+  return enabled;
+}
+
+class PoolResource final : public std::pmr::memory_resource {
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    std::size_t class_bytes = 0;
+    const int index = SizeClass(bytes, alignment, class_bytes);
+    if (index < 0) {
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    if (!tls_cache_destroyed && Enabled().load(std::memory_order_relaxed)) {
+      Cache& cache = tls_cache;
+      if (Block* block = cache.free[index]) {
+        cache.free[index] = block->next;
+        cache.stats.bytes_retained -= class_bytes;
+        --cache.stats.blocks_retained;
+        ++cache.stats.hits;
+        return block;
+      }
+      ++cache.stats.misses;
+    }
+    return ::operator new(class_bytes, std::align_val_t{kAlignment});
+  }
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::size_t class_bytes = 0;
+    const int index = SizeClass(bytes, alignment, class_bytes);
+    if (index < 0) {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+      return;
+    }
+    if (!tls_cache_destroyed && Enabled().load(std::memory_order_relaxed)) {
+      Cache& cache = tls_cache;
+      if (cache.stats.bytes_retained + class_bytes <=
+          cap.load(std::memory_order_relaxed)) {
+        Block* block = static_cast<Block*>(p);
+        block->next = cache.free[index];
+        cache.free[index] = block;
+        cache.stats.bytes_retained += class_bytes;
+        ++cache.stats.blocks_retained;
+        return;
+      }
+    }
+    Free(p);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+/******************************************************************************
+ * SETTINGS
+ ******************************************************************************/
+
+/**
+ * Turns the pool on or off for matrices allocated from now on. While it is
+ * off, matrices that took the pool earlier allocate from operator new as
+ * well. Turning it off also frees the buffers the calling thread retains;
+ * other threads free theirs on exit or with TrimBufferPool().
+ */
+void SetBufferPoolEnabled(bool enabled) noexcept {
+  Enabled().store(enabled, std::memory_order_relaxed);
+  if (!enabled) TrimBufferPool();
+}
+
+bool IsBufferPoolEnabled() noexcept {
+  return Enabled().load(std::memory_order_relaxed);
+}
+
+/**
+ * Sets how many bytes of released buffers each thread keeps at most, 64 MiB
+ * by default. Buffers released beyond the cap go back to operator delete.
+ */
+void SetBufferPoolCap(std::size_t bytes) noexcept {
+  cap.store(bytes, std::memory_order_relaxed);
+}
+
+std::size_t GetBufferPoolCap() noexcept {
+  return cap.load(std::memory_order_relaxed);
+}
+
+/******************************************************************************
+ * STATISTICS
+ ******************************************************************************/
+
+/**
+ * Returns the counters of the calling thread.
+ */
+S21BufferPoolStats GetBufferPoolStats() noexcept {
+  return tls_cache_destroyed ? S21BufferPoolStats{} : tls_cache.stats;
+}
+
+/**
+ * Frees the buffers the calling thread retains; the hit and miss counters
+ * are kept.
+ */
+void TrimBufferPool() noexcept {
+  if (!tls_cache_destroyed) tls_cache.Trim();
+}
+
+/**
+ * Returns the resource of the pool, for matrices that should use it whether
+ * or not it is enabled.
+ */
+std::pmr::memory_resource* BufferPoolResource() noexcept {
+  // Never destroyed: matrices with static storage may release buffers late
+  static PoolResource* const resource = new PoolResource;
+  return resource;
+}
+
+}  // namespace S21
@@ -0,0 +1,50 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_buffer_pool.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the thread-local buffer pool of the
+ * CPP1_s21_matrixplus project.
+ *
+ * @details When the pool is enabled (S21_BUFFER_POOL=1 in the environment
+ * or SetBufferPoolEnabled()), matrices without a memory resource of their
+ * own take their heap buffers from it. Released buffers are kept per thread
+ * in size classes, four per power of two, up to a cap of retained bytes, and
+ * the next allocation of the same class on that thread reuses them, so a
+ * steady workload stops calling the system allocator. A buffer may be
+ * released on any thread.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_BUFFER_POOL_H_
+#define CPP1_S21_MATRIXPLUS_S21_BUFFER_POOL_H_
+
+#include <cstddef>          // std::size_t
+#include <memory_resource>  // std::pmr::memory_resource
+
+namespace S21 {
+
+// Counters of the calling thread's pool
+struct S21BufferPoolStats {
+  std::size_t hits;             // allocations served by a retained buffer
+  std::size_t misses;           // allocations that went to operator new
+  std::size_t bytes_retained;   // bytes of the buffers kept for reuse
+  std::size_t blocks_retained;  // number of those buffers
+};
+
+void SetBufferPoolEnabled(bool enabled) noexcept;
+bool IsBufferPoolEnabled() noexcept;
+void SetBufferPoolCap(std::size_t bytes) noexcept;
+std::size_t GetBufferPoolCap() noexcept;
+S21BufferPoolStats GetBufferPoolStats() noexcept;
+void TrimBufferPool() noexcept;
+std::pmr::memory_resource* BufferPoolResource() noexcept;
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_BUFFER_POOL_H_
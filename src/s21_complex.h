@@ -0,0 +1,64 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_complex.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the complex element support of the
+ * CPP1_s21_matrixplus project: element type traits and the 3M product.
+ *
+ * @details BasicMatrix is instantiated for std::complex<float> and
+ * std::complex<double>. Pivots and tolerances of complex matrices are
+ * compared by magnitude, in the real type of the elements.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_COMPLEX_H_
+#define CPP1_S21_MATRIXPLUS_S21_COMPLEX_H_
+
+#include <complex>  // std::complex | std::conj
+#include <cstddef>  // std::ptrdiff_t
+
+namespace S21 {
+namespace internal {
+
+// The type of |x| for an element x: R for std::complex<R>, T otherwise
+template <class T>
+struct RealTypeOf {
+  using type = T;
+};
+template <class R>
+struct RealTypeOf<std::complex<R>> {
+  using type = R;
+};
+template <class T>
+using RealType = typename RealTypeOf<T>::type;
+
+template <class T>
+inline constexpr bool kIsComplex = false;
+template <class R>
+inline constexpr bool kIsComplex<std::complex<R>> = true;
+
+// Complex conjugate that keeps real elements real, unlike std::conj
+template <class T>
+T Conj(const T& x) noexcept {
+  if constexpr (kIsComplex<T>) {
+    return std::conj(x);
+  } else {
+    return x;
+  }
+}
+
+template <class R>
+void Gemm3M(int m, int n, int k, const std::complex<R>* a, std::ptrdiff_t lda,
+            const std::complex<R>* b, std::ptrdiff_t ldb, std::complex<R>* c,
+            std::ptrdiff_t ldc);
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_COMPLEX_H_
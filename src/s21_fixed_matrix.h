@@ -0,0 +1,517 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_fixed_matrix.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the fixed-size matrix of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @details S21FixedMatrix keeps its elements inline in a std::array, checks
+ * dimensions at compile time and unrolls the arithmetic through index
+ * sequences, so 2x2 ... 4x4 transforms never touch the heap. Every
+ * operation can be evaluated in a constant expression.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_FIXED_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_S21_FIXED_MATRIX_H_
+
+#include <algorithm>  // std::copy_n
+#include <array>
+#include <initializer_list>
+#include <limits>     // kMinEps
+#include <stdexcept>  // out_of_range | invalid_argument
+#include <utility>    // std::integer_sequence
+
+#include "s21_matrix_oop.h"
+
+namespace S21 {
+
+template <int Rows, int Cols>
+class S21FixedMatrix {
+  static_assert(Rows > 0 && Cols > 0, "Matrix size must be greater than zero");
+
+ public:
+  constexpr S21FixedMatrix() noexcept : data_{} {}
+  constexpr S21FixedMatrix(
+      std::initializer_list<std::initializer_list<double>> initList);
+  explicit S21FixedMatrix(const S21Matrix& other);
+
+  explicit operator S21Matrix() const;
+  S21Matrix ToMatrix() const;
+
+  // Main methods
+  constexpr bool EqMatrix(const S21FixedMatrix& other) const noexcept;
+  constexpr void SumMatrix(const S21FixedMatrix& other) noexcept;
+  constexpr void SubMatrix(const S21FixedMatrix& other) noexcept;
+  constexpr void MulNumber(const double num) noexcept;
+  constexpr void MulMatrix(const S21FixedMatrix<Cols, Cols>& other) noexcept;
+  constexpr S21FixedMatrix<Cols, Rows> Transpose() const noexcept;
+  constexpr double Determinant() const noexcept;
+  constexpr S21FixedMatrix CalcComplements() const noexcept;
+  constexpr S21FixedMatrix InverseMatrix() const;
+
+  static constexpr int GetRows() noexcept { return Rows; }
+  static constexpr int GetCols() noexcept { return Cols; }
+
+  // Overloaded methods
+  constexpr bool operator==(const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix operator+(
+      const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix& operator+=(const S21FixedMatrix& other) noexcept;
+  constexpr S21FixedMatrix operator-(
+      const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix& operator-=(const S21FixedMatrix& other) noexcept;
+  constexpr S21FixedMatrix operator*(const double& num) const noexcept;
+  constexpr S21FixedMatrix& operator*=(const double& num) noexcept;
+  template <int K>
+  constexpr S21FixedMatrix<Rows, K> operator*(
+      const S21FixedMatrix<Cols, K>& other) const noexcept;
+  constexpr S21FixedMatrix& operator*=(
+      const S21FixedMatrix<Cols, Cols>& other) noexcept;
+  constexpr double operator()(int i, int j) const;
+  constexpr double& operator()(int i, int j);
+
+  // Element access checked at compile time
+  template <int I, int J>
+  constexpr double Get() const noexcept;
+  template <int I, int J>
+  constexpr double& Get() noexcept;
+
+ private:
+  template <int, int>
+  friend class S21FixedMatrix;
+
+  constexpr static const double kMinEps =
+      std::numeric_limits<double>::epsilon();
+  constexpr static const int kSize = Rows * Cols;
+
+  static constexpr double Abs(double value) noexcept {
+    return value < 0 ? -value : value;
+  }
+
+  template <int... I>
+  constexpr void Add(const S21FixedMatrix& other, double sign,
+                     std::integer_sequence<int, I...>) noexcept {
+    ((data_[I] += sign * other.data_[I]), ...);
+  }
+  template <int... I>
+  constexpr void Scale(double num, std::integer_sequence<int, I...>) noexcept {
+    ((data_[I] *= num), ...);
+  }
+  template <int K, int... L>
+  constexpr double Dot(int i, int j, const S21FixedMatrix<Cols, K>& other,
+                       std::integer_sequence<int, L...>) const noexcept {
+    return ((data_[i * Cols + L] * other.data_[L * K + j]) + ...);
+  }
+  template <int K, int... I>
+  constexpr S21FixedMatrix<Rows, K> Multiply(
+      const S21FixedMatrix<Cols, K>& other,
+      std::integer_sequence<int, I...>) const noexcept {
+    S21FixedMatrix<Rows, K> result;
+    ((result.data_[I] = Dot(I / K, I % K, other,
+                            std::make_integer_sequence<int, Cols>{})),
+     ...);
+    return result;
+  }
+  template <int... I>
+  constexpr S21FixedMatrix<Cols, Rows> Transposed(
+      std::integer_sequence<int, I...>) const noexcept {
+    S21FixedMatrix<Cols, Rows> result;
+    ((result.data_[I] = data_[I % Rows * Cols + I / Rows]), ...);
+    return result;
+  }
+
+  constexpr double Minor(int i, int j) const noexcept;
+  constexpr double EliminationDeterminant() const noexcept;
+  constexpr S21FixedMatrix GaussJordanInverse() const noexcept;
+
+  std::array<double, kSize> data_;
+};
+
+/******************************************************************************
+ * CONSTRUCTORS & CONVERSIONS
+ ******************************************************************************/
+
+/**
+ * Fills the matrix row by row, missing elements stay zero.
+ *
+ * @throws std::invalid_argument if the list has too many rows or columns
+ */
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>::S21FixedMatrix(
+    std::initializer_list<std::initializer_list<double>> initList)
+    : data_{} {
+  if (initList.size() > static_cast<std::size_t>(Rows)) {
+    throw std::invalid_argument("Too many rows for the fixed matrix");
+  }
+  int i = 0;
+  for (const auto& row : initList) {
+    if (row.size() > static_cast<std::size_t>(Cols)) {
+      throw std::invalid_argument("Too many cols for the fixed matrix");
+    }
+    int j = 0;
+    for (const double value : row) {
+      data_[i * Cols + j++] = value;
+    }
+    ++i;
+  }
+}
+
+/**
+ * Copies a dynamic matrix of the same size.
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+template <int Rows, int Cols>
+S21FixedMatrix<Rows, Cols>::S21FixedMatrix(const S21Matrix& other) : data_{} {
+  if (other.GetRows() != Rows || other.GetCols() != Cols) {
+    throw std::invalid_argument("Incorrect matrix dimensions for conversion");
+  }
+  for (int i = 0; i < Rows; ++i) {
+    std::copy_n(other.RowPtr(i), Cols, data_.begin() + i * Cols);
+  }
+}
+
+template <int Rows, int Cols>
+S21FixedMatrix<Rows, Cols>::operator S21Matrix() const {
+  return ToMatrix();
+}
+
+template <int Rows, int Cols>
+S21Matrix S21FixedMatrix<Rows, Cols>::ToMatrix() const {
+  S21Matrix result{Rows, Cols};
+  for (int i = 0; i < Rows; ++i) {
+    std::copy_n(data_.begin() + i * Cols, Cols, result.RowPtr(i));
+  }
+  return result;
+}
+
+/******************************************************************************
+ * MAIN METHODS
+ ******************************************************************************/
+
+template <int Rows, int Cols>
+constexpr bool S21FixedMatrix<Rows, Cols>::EqMatrix(
+    const S21FixedMatrix& other) const noexcept {
+  for (int i = 0; i < kSize; ++i) {
+    if (data_[i] != other.data_[i]) return false;
+  }
+  return true;
+}
+
+template <int Rows, int Cols>
+constexpr void S21FixedMatrix<Rows, Cols>::SumMatrix(
+    const S21FixedMatrix& other) noexcept {
+  Add(other, 1.0, std::make_integer_sequence<int, kSize>{});
+}
+
+template <int Rows, int Cols>
+constexpr void S21FixedMatrix<Rows, Cols>::SubMatrix(
+    const S21FixedMatrix& other) noexcept {
+  Add(other, -1.0, std::make_integer_sequence<int, kSize>{});
+}
+
+template <int Rows, int Cols>
+constexpr void S21FixedMatrix<Rows, Cols>::MulNumber(
+    const double num) noexcept {
+  Scale(num, std::make_integer_sequence<int, kSize>{});
+}
+
+/**
+ * Multiplies by a square matrix, which keeps the shape of this one.
+ */
+template <int Rows, int Cols>
+constexpr void S21FixedMatrix<Rows, Cols>::MulMatrix(
+    const S21FixedMatrix<Cols, Cols>& other) noexcept {
+  *this = *this * other;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Cols, Rows> S21FixedMatrix<Rows, Cols>::Transpose()
+    const noexcept {
+  return Transposed(std::make_integer_sequence<int, kSize>{});
+}
+
+/**
+ * Calculates the determinant.
+ *
+ * @details Closed formulas up to 4x4 (the 4x4 one by complementary 2x2
+ * minors), Gauss elimination with partial pivoting above.
+ */
+template <int Rows, int Cols>
+constexpr double S21FixedMatrix<Rows, Cols>::Determinant() const noexcept {
+  static_assert(Rows == Cols, "Determinant needs a square matrix");
+  const auto& m = data_;
+  if constexpr (Rows == 1) {
+    return m[0];
+  } else if constexpr (Rows == 2) {
+    return m[0] * m[3] - m[1] * m[2];
+  } else if constexpr (Rows == 3) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7]) -
+           m[1] * (m[3] * m[8] - m[5] * m[6]) +
+           m[2] * (m[3] * m[7] - m[4] * m[6]);
+  } else if constexpr (Rows == 4) {
+    const double s0 = m[0] * m[5] - m[1] * m[4];
+    const double s1 = m[0] * m[6] - m[2] * m[4];
+    const double s2 = m[0] * m[7] - m[3] * m[4];
+    const double s3 = m[1] * m[6] - m[2] * m[5];
+    const double s4 = m[1] * m[7] - m[3] * m[5];
+    const double s5 = m[2] * m[7] - m[3] * m[6];
+    const double c5 = m[10] * m[15] - m[11] * m[14];
+    const double c4 = m[9] * m[15] - m[11] * m[13];
+    const double c3 = m[9] * m[14] - m[10] * m[13];
+    const double c2 = m[8] * m[15] - m[11] * m[12];
+    const double c1 = m[8] * m[14] - m[10] * m[12];
+    const double c0 = m[8] * m[13] - m[9] * m[12];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  } else {
+    return EliminationDeterminant();
+  }
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>
+S21FixedMatrix<Rows, Cols>::CalcComplements() const noexcept {
+  static_assert(Rows == Cols, "CalcComplements needs a square matrix");
+  S21FixedMatrix result;
+  if constexpr (Rows == 1) {
+    result.data_[0] = 1.0;
+  } else {
+    for (int i = 0; i < Rows; ++i) {
+      for (int j = 0; j < Cols; ++j) {
+        result.data_[i * Cols + j] = Minor(i, j);
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * Calculates the inverse matrix: the adjugate up to 4x4, Gauss-Jordan
+ * elimination above.
+ *
+ * @throws std::invalid_argument if the determinant is zero
+ */
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>
+S21FixedMatrix<Rows, Cols>::InverseMatrix() const {
+  static_assert(Rows == Cols, "InverseMatrix needs a square matrix");
+  const double det = Determinant();
+  if (Abs(det) < kMinEps) {
+    throw std::invalid_argument(
+        "Determinant must be non-zero to calculate Inverse");
+  }
+  if constexpr (Rows <= 4) {
+    return CalcComplements().Transpose() * (1 / det);
+  } else {
+    return GaussJordanInverse();
+  }
+}
+
+/******************************************************************************
+ * OVERLOADED METHODS
+ ******************************************************************************/
+
+template <int Rows, int Cols>
+constexpr bool S21FixedMatrix<Rows, Cols>::operator==(
+    const S21FixedMatrix& other) const noexcept {
+  return EqMatrix(other);
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols> S21FixedMatrix<Rows, Cols>::operator+(
+    const S21FixedMatrix& other) const noexcept {
+  S21FixedMatrix tmp = *this;
+  tmp.SumMatrix(other);
+  return tmp;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>& S21FixedMatrix<Rows, Cols>::operator+=(
+    const S21FixedMatrix& other) noexcept {
+  SumMatrix(other);
+  return *this;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols> S21FixedMatrix<Rows, Cols>::operator-(
+    const S21FixedMatrix& other) const noexcept {
+  S21FixedMatrix tmp = *this;
+  tmp.SubMatrix(other);
+  return tmp;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>& S21FixedMatrix<Rows, Cols>::operator-=(
+    const S21FixedMatrix& other) noexcept {
+  SubMatrix(other);
+  return *this;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols> S21FixedMatrix<Rows, Cols>::operator*(
+    const double& num) const noexcept {
+  S21FixedMatrix tmp = *this;
+  tmp.MulNumber(num);
+  return tmp;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>& S21FixedMatrix<Rows, Cols>::operator*=(
+    const double& num) noexcept {
+  MulNumber(num);
+  return *this;
+}
+
+/**
+ * Multiplies matrices; mismatched inner dimensions do not compile.
+ */
+template <int Rows, int Cols>
+template <int K>
+constexpr S21FixedMatrix<Rows, K> S21FixedMatrix<Rows, Cols>::operator*(
+    const S21FixedMatrix<Cols, K>& other) const noexcept {
+  return Multiply(other, std::make_integer_sequence<int, Rows * K>{});
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>& S21FixedMatrix<Rows, Cols>::operator*=(
+    const S21FixedMatrix<Cols, Cols>& other) noexcept {
+  MulMatrix(other);
+  return *this;
+}
+
+/**
+ * Returns the element at the given indices.
+ *
+ * @throws std::out_of_range if the indices are outside the matrix
+ */
+template <int Rows, int Cols>
+constexpr double S21FixedMatrix<Rows, Cols>::operator()(int i, int j) const {
+  if (i < 0 || j < 0 || i >= Rows || j >= Cols) {
+    throw std::out_of_range("Index outside the matrix");
+  }
+  return data_[i * Cols + j];
+}
+
+template <int Rows, int Cols>
+constexpr double& S21FixedMatrix<Rows, Cols>::operator()(int i, int j) {
+  if (i < 0 || j < 0 || i >= Rows || j >= Cols) {
+    throw std::out_of_range("Index outside the matrix");
+  }
+  return data_[i * Cols + j];
+}
+
+template <int Rows, int Cols>
+template <int I, int J>
+constexpr double S21FixedMatrix<Rows, Cols>::Get() const noexcept {
+  static_assert(I >= 0 && J >= 0 && I < Rows && J < Cols,
+                "Index outside the matrix");
+  return data_[I * Cols + J];
+}
+
+template <int Rows, int Cols>
+template <int I, int J>
+constexpr double& S21FixedMatrix<Rows, Cols>::Get() noexcept {
+  static_assert(I >= 0 && J >= 0 && I < Rows && J < Cols,
+                "Index outside the matrix");
+  return data_[I * Cols + J];
+}
+
+/******************************************************************************
+ * PRIVATE METHODS
+ ******************************************************************************/
+
+/**
+ * Calculates the signed minor (the complement) at the given position.
+ */
+template <int Rows, int Cols>
+constexpr double S21FixedMatrix<Rows, Cols>::Minor(int i,
+                                                   int j) const noexcept {
+  S21FixedMatrix<Rows - 1, Cols - 1> minor;
+  for (int k = 0; k < Rows - 1; ++k) {
+    for (int l = 0; l < Cols - 1; ++l) {
+      minor.data_[k * (Cols - 1) + l] =
+          data_[(k < i ? k : k + 1) * Cols + (l < j ? l : l + 1)];
+    }
+  }
+  return minor.Determinant() * ((i + j) % 2 ? -1 : 1);
+}
+
+template <int Rows, int Cols>
+constexpr double S21FixedMatrix<Rows, Cols>::EliminationDeterminant()
+    const noexcept {
+  std::array<double, kSize> m = data_;
+  double det = 1.0;
+  for (int k = 0; k < Rows; ++k) {
+    int pivot = k;
+    for (int i = k + 1; i < Rows; ++i) {
+      if (Abs(m[i * Cols + k]) > Abs(m[pivot * Cols + k])) pivot = i;
+    }
+    if (pivot != k) {
+      for (int j = 0; j < Cols; ++j) {
+        const double tmp = m[k * Cols + j];
+        m[k * Cols + j] = m[pivot * Cols + j];
+        m[pivot * Cols + j] = tmp;
+      }
+      det = -det;
+    }
+    det *= m[k * Cols + k];
+    if (!m[k * Cols + k]) return 0.0;
+    for (int i = k + 1; i < Rows; ++i) {
+      const double ratio = m[i * Cols + k] / m[k * Cols + k];
+      for (int j = k + 1; j < Cols; ++j) {
+        m[i * Cols + j] -= ratio * m[k * Cols + j];
+      }
+    }
+  }
+  return det;
+}
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols>
+S21FixedMatrix<Rows, Cols>::GaussJordanInverse() const noexcept {
+  std::array<double, kSize> m = data_;
+  S21FixedMatrix result;
+  for (int i = 0; i < Rows; ++i) {
+    result.data_[i * Cols + i] = 1.0;
+  }
+  auto& r = result.data_;
+  for (int k = 0; k < Rows; ++k) {
+    int pivot = k;
+    for (int i = k + 1; i < Rows; ++i) {
+      if (Abs(m[i * Cols + k]) > Abs(m[pivot * Cols + k])) pivot = i;
+    }
+    for (int j = 0; j < Cols; ++j) {
+      const double a = m[k * Cols + j];
+      m[k * Cols + j] = m[pivot * Cols + j];
+      m[pivot * Cols + j] = a;
+      const double b = r[k * Cols + j];
+      r[k * Cols + j] = r[pivot * Cols + j];
+      r[pivot * Cols + j] = b;
+    }
+    const double scale = 1 / m[k * Cols + k];
+    for (int j = 0; j < Cols; ++j) {
+      m[k * Cols + j] *= scale;
+      r[k * Cols + j] *= scale;
+    }
+    for (int i = 0; i < Rows; ++i) {
+      if (i == k) continue;
+      const double ratio = m[i * Cols + k];
+      for (int j = 0; j < Cols; ++j) {
+        m[i * Cols + j] -= ratio * m[k * Cols + j];
+        r[i * Cols + j] -= ratio * r[k * Cols + j];
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_FIXED_MATRIX_H_
@@ -0,0 +1,302 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_gemm.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Blocked general matrix multiplication of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @details The loop nest follows the Goto/BLIS scheme: B is packed into
+ * kKc x kNc panels, A into kMc x kKc blocks, and a register-tiled
+ * micro-kernel computes mr x nr tiles of C from the packed data. Large
+ * products split C into kMc-row by column-chunk tiles that the thread pool
+ * schedules across workers; every tile packs its own block of A.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_gemm.h"
+
+#include <algorithm>  // std::min | std::max | std::fill_n
+#include <cstddef>    // std::size_t
+#include <memory>     // std::unique_ptr
+#include <new>        // std::align_val_t
+
+#include "s21_kernels.h"
+#include "s21_thread_pool.h"
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+constexpr std::size_t kPackAlignment = 64;
+
+/**
+ * Cache-line-aligned scratch buffer for packed panels.
+ */
+template <class T>
+class PackBuffer {
+ public:
+  explicit PackBuffer(std::size_t size)
+      : data_(static_cast<T*>(::operator new(
+            sizeof(T) * size, std::align_val_t{kPackAlignment}))) {}
+  PackBuffer(const PackBuffer&) = delete;
+  PackBuffer& operator=(const PackBuffer&) = delete;
+  ~PackBuffer() noexcept {
+    ::operator delete(data_, std::align_val_t{kPackAlignment});
+  }
+
+  T* data() noexcept { return data_; }
+
+ private:
+  T* data_;
+};
+
+/**
+ * Returns a per-thread packing buffer of at least size elements.
+ */
+template <class T>
+T* ThreadPackBuffer(std::size_t size) {
+  thread_local std::unique_ptr<PackBuffer<T>> buffer;
+  thread_local std::size_t capacity = 0;
+  if (capacity < size) {
+    buffer.reset();
+    buffer = std::make_unique<PackBuffer<T>>(size);
+    capacity = size;
+  }
+  return buffer->data();
+}
+
+int RoundUp(int value, int step) { return (value + step - 1) / step * step; }
+
+/**
+ * Packs an mc x kc block of A into mr-row panels, each stored column by
+ * column. The last panel is zero-padded to a full mr rows.
+ */
+template <class T>
+void PackA(int mc, int kc, const T* a, std::ptrdiff_t lda, int mr, T* dst) {
+  for (int i = 0; i < mc; i += mr) {
+    const int rows = std::min(mr, mc - i);
+    for (int l = 0; l < kc; ++l) {
+      int r = 0;
+      for (; r < rows; ++r) {
+        dst[r] = a[(i + r) * lda + l];
+      }
+      for (; r < mr; ++r) {
+        dst[r] = T{};
+      }
+      dst += mr;
+    }
+  }
+}
+
+/**
+ * Packs a kc x nc block of B into nr-column panels, each stored row by row.
+ * The last panel is zero-padded to a full nr columns.
+ */
+template <class T>
+void PackB(int kc, int nc, const T* b, std::ptrdiff_t ldb, int nr, T* dst) {
+  for (int j = 0; j < nc; j += nr) {
+    const int cols = std::min(nr, nc - j);
+    for (int l = 0; l < kc; ++l) {
+      const T* src = b + l * ldb + j;
+      int c = 0;
+      for (; c < cols; ++c) {
+        dst[c] = src[c];
+      }
+      for (; c < nr; ++c) {
+        dst[c] = T{};
+      }
+      dst += nr;
+    }
+  }
+}
+
+/**
+ * Runs the micro-kernel over all tiles of an mc x nc block of C. Tiles
+ * hanging over the edge of C are computed in a scratch tile first.
+ */
+template <class T>
+void MacroKernel(const BasicGemmKernel<T>& kernel, int mc, int nc, int kc,
+                 const T* packed_a, const T* packed_b, T* c, std::ptrdiff_t ldc,
+                 T alpha) {
+  const int mr = kernel.mr;
+  const int nr = kernel.nr;
+  alignas(kPackAlignment) T edge[kMaxMr * kMaxNr];
+
+  for (int j = 0; j < nc; j += nr) {
+    const int cols = std::min(nr, nc - j);
+    const T* b_panel = packed_b + static_cast<std::ptrdiff_t>(j) * kc;
+    for (int i = 0; i < mc; i += mr) {
+      const int rows = std::min(mr, mc - i);
+      const T* a_panel = packed_a + static_cast<std::ptrdiff_t>(i) * kc;
+      T* c_tile = c + i * ldc + j;
+      if (rows == mr && cols == nr) {
+        kernel.micro(kc, a_panel, b_panel, c_tile, ldc, alpha);
+      } else {
+        std::fill_n(edge, mr * nr, T{});
+        kernel.micro(kc, a_panel, b_panel, edge, nr, alpha);
+        for (int r = 0; r < rows; ++r) {
+          for (int s = 0; s < cols; ++s) {
+            c_tile[r * ldc + s] += edge[r * nr + s];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Unpacked i-k-j product for operands too small to amortize packing.
+ */
+template <class T>
+void GemmSmall(int m, int n, int k, T alpha, const T* a, std::ptrdiff_t lda,
+               const T* b, std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc) {
+  const auto axpy = Kernels<T>().axpy;
+  for (int i = 0; i < m; ++i) {
+    T* c_row = c + i * ldc;
+    for (int l = 0; l < k; ++l) {
+      axpy(n, alpha * a[i * lda + l], b + l * ldb, c_row);
+    }
+  }
+}
+
+/**
+ * Parallel variant of GemmPacked. For every kKc slice B is packed by all
+ * threads, then the kMc x chunk tiles of C are computed concurrently.
+ */
+template <class T>
+void GemmParallel(ThreadPool& pool, const BasicGemmKernel<T>& kernel, int m,
+                  int n, int k, T alpha, const T* a, std::ptrdiff_t lda,
+                  const T* b, std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc) {
+  const int mr = kernel.mr;
+  const int nr = kernel.nr;
+  const int m_blocks = (m + kMc - 1) / kMc;
+  PackBuffer<T> packed_b(static_cast<std::size_t>(std::min(k, kKc)) *
+                         RoundUp(std::min(n, kNc), nr));
+
+  for (int jc = 0; jc < n; jc += kNc) {
+    const int nc = std::min(kNc, n - jc);
+    // Split the columns so that every thread gets about two tiles
+    const int panels = (nc + nr - 1) / nr;
+    const int chunks_wanted =
+        std::max(1, (2 * pool.Size() + m_blocks - 1) / m_blocks);
+    const int chunk_panels = (panels + chunks_wanted - 1) / chunks_wanted;
+    const int chunks = (panels + chunk_panels - 1) / chunk_panels;
+    const int chunk_cols = chunk_panels * nr;
+
+    for (int pc = 0; pc < k; pc += kKc) {
+      const int kc = std::min(kKc, k - pc);
+      pool.ParallelFor(chunks, [&](int t) {
+        const int j0 = t * chunk_cols;
+        PackB(kc, std::min(chunk_cols, nc - j0), b + pc * ldb + jc + j0, ldb,
+              nr, packed_b.data() + static_cast<std::ptrdiff_t>(j0) * kc);
+      });
+      pool.ParallelFor(m_blocks * chunks, [&](int t) {
+        const int ic = t / chunks * kMc;
+        const int j0 = t % chunks * chunk_cols;
+        const int mc = std::min(kMc, m - ic);
+        T* packed_a = ThreadPackBuffer<T>(static_cast<std::size_t>(kc) *
+                                          RoundUp(mc, mr));
+        PackA(mc, kc, a + ic * lda + pc, lda, mr, packed_a);
+        MacroKernel(kernel, mc, std::min(chunk_cols, nc - j0), kc, packed_a,
+                    packed_b.data() + static_cast<std::ptrdiff_t>(j0) * kc,
+                    c + ic * ldc + jc + j0, ldc, alpha);
+      });
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * Computes C += alpha * A * B for row-major operands.
+ *
+ * @param m rows of A and C
+ * @param n cols of B and C
+ * @param k cols of A and rows of B
+ * @param alpha scale applied to the product
+ * @param a, lda matrix A and its leading dimension
+ * @param b, ldb matrix B and its leading dimension
+ * @param c, ldc matrix C and its leading dimension
+ *
+ * @throws std::bad_alloc if the packing buffers cannot be allocated
+ */
+template <class T>
+void Gemm(int m, int n, int k, typename NoDeduce<T>::type alpha, const T* a,
+          std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+          std::ptrdiff_t ldc) {
+  if (m <= 0 || n <= 0 || k <= 0) return;
+  if (static_cast<long long>(m) * n * k <= kGemmSmallSize) {
+    GemmSmall(m, n, k, alpha, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  GemmPacked(Kernels<T>().gemm, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+}
+
+/**
+ * Computes C += alpha * A * B through packing and the given micro-kernel.
+ *
+ * @details Products of at least kGemmParallelSize multiply-adds run on the
+ * library thread pool.
+ *
+ * @throws std::bad_alloc if the packing buffers cannot be allocated
+ */
+template <class T>
+void GemmPacked(const BasicGemmKernel<T>& kernel, int m, int n, int k,
+                typename NoDeduce<T>::type alpha, const T* a,
+                std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+                std::ptrdiff_t ldc) {
+  if (m <= 0 || n <= 0 || k <= 0) return;
+  if (static_cast<long long>(m) * n * k >= kGemmParallelSize) {
+    ThreadPool& pool = ThreadPool::Global();
+    if (pool.Size() > 1) {
+      GemmParallel(pool, kernel, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+      return;
+    }
+  }
+  const int nc_max = std::min(n, kNc);
+  const int mc_max = std::min(m, kMc);
+  const int kc_max = std::min(k, kKc);
+  PackBuffer<T> packed_b(static_cast<std::size_t>(kc_max) *
+                         RoundUp(nc_max, kernel.nr));
+  PackBuffer<T> packed_a(static_cast<std::size_t>(kc_max) *
+                         RoundUp(mc_max, kernel.mr));
+
+  for (int jc = 0; jc < n; jc += kNc) {
+    const int nc = std::min(kNc, n - jc);
+    for (int pc = 0; pc < k; pc += kKc) {
+      const int kc = std::min(kKc, k - pc);
+      PackB(kc, nc, b + pc * ldb + jc, ldb, kernel.nr, packed_b.data());
+      for (int ic = 0; ic < m; ic += kMc) {
+        const int mc = std::min(kMc, m - ic);
+        PackA(mc, kc, a + ic * lda + pc, lda, kernel.mr, packed_a.data());
+        MacroKernel(kernel, mc, nc, kc, packed_a.data(), packed_b.data(),
+                    c + ic * ldc + jc, ldc, alpha);
+      }
+    }
+  }
+}
+
+#define S21_INSTANTIATE_GEMM(T)                                            \
+  template void Gemm<T>(int, int, int, T, const T*, std::ptrdiff_t,        \
+                        const T*, std::ptrdiff_t, T*, std::ptrdiff_t);     \
+  template void GemmPacked<T>(const BasicGemmKernel<T>&, int, int, int, T, \
+                              const T*, std::ptrdiff_t, const T*,          \
+                              std::ptrdiff_t, T*, std::ptrdiff_t);
+
+S21_INSTANTIATE_GEMM(float)
+S21_INSTANTIATE_GEMM(double)
+S21_INSTANTIATE_GEMM(long double)
+S21_INSTANTIATE_GEMM(int)
+S21_INSTANTIATE_GEMM(long long)
+S21_INSTANTIATE_GEMM(std::complex<float>)
+S21_INSTANTIATE_GEMM(std::complex<double>)
+
+}  // namespace internal
+}  // namespace S21
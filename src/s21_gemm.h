@@ -0,0 +1,79 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_gemm.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the general matrix multiplication engine
+ * used by S21Matrix::MulMatrix and the multiplication operators.
+ *
+ * @details Gemm and GemmPacked are instantiated for every element type of
+ * BasicMatrix (s21_matrix_oop.h).
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_GEMM_H_
+#define CPP1_S21_MATRIXPLUS_S21_GEMM_H_
+
+#include <cstddef>  // std::ptrdiff_t
+
+namespace S21 {
+namespace internal {
+
+// Lets T be deduced from the pointers alone, so that a literal such as 1.0
+// can scale a product of any element type
+template <class T>
+struct NoDeduce {
+  using type = T;
+};
+
+/**
+ * Register-tiled micro-kernel: C[mr x nr] += alpha * Ap * Bp, where Ap is a
+ * packed kc x mr panel of A and Bp a packed kc x nr panel of B.
+ */
+template <class T>
+using BasicMicroKernel = void (*)(int kc, const T* a, const T* b, T* c,
+                                  std::ptrdiff_t ldc, T alpha);
+
+template <class T>
+struct BasicGemmKernel {
+  int mr;  // rows of the register tile
+  int nr;  // cols of the register tile
+  BasicMicroKernel<T> micro;
+};
+
+using MicroKernel = BasicMicroKernel<double>;
+using GemmKernel = BasicGemmKernel<double>;
+
+// Cache blocking: a kc x nr panel of B and a kc x mr panel of A stay in L1,
+// a kMc x kKc block of A stays in L2, a kKc x kNc panel of B stays in L3.
+constexpr int kKc = 256;
+constexpr int kMc = 96;
+constexpr int kNc = 4096;
+// Register tiles are at most kMaxMr x kMaxNr
+constexpr int kMaxMr = 16;
+constexpr int kMaxNr = 32;
+
+// Below this many multiply-adds packing costs more than it saves
+constexpr long long kGemmSmallSize = 32LL * 32 * 32;
+// Below this many multiply-adds a single thread beats scheduling tiles
+constexpr long long kGemmParallelSize = 128LL * 128 * 128;
+
+template <class T>
+void Gemm(int m, int n, int k, typename NoDeduce<T>::type alpha, const T* a,
+          std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+          std::ptrdiff_t ldc);
+template <class T>
+void GemmPacked(const BasicGemmKernel<T>& kernel, int m, int n, int k,
+                typename NoDeduce<T>::type alpha, const T* a,
+                std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+                std::ptrdiff_t ldc);
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_GEMM_H_
@@ -0,0 +1,185 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_kernels.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Portable kernels and the CPUID-based kernel dispatch of the
+ * CPP1_s21_matrixplus project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_kernels.h"
+
+#include <cstdlib>  // std::getenv
+#include <cstring>  // std::strcmp
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+template <class T>
+void AddScalar(std::ptrdiff_t n, const T* x, T* y) {
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    y[i] += x[i];
+  }
+}
+
+template <class T>
+void SubScalar(std::ptrdiff_t n, const T* x, T* y) {
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    y[i] -= x[i];
+  }
+}
+
+template <class T>
+void ScaleScalar(std::ptrdiff_t n, T alpha, T* y) {
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+template <class T>
+void AxpyScalar(std::ptrdiff_t n, T alpha, const T* x, T* y) {
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+template <class T>
+void TransposeScalar(int rows, int cols, const T* a, std::ptrdiff_t lda, T* b,
+                     std::ptrdiff_t ldb) {
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * Portable 4x4 micro-kernel; the 16 accumulators live in registers.
+ */
+template <class T>
+void MicroKernelScalar4x4(int kc, const T* a, const T* b, T* c,
+                          std::ptrdiff_t ldc, T alpha) {
+  T acc[4][4] = {};
+  for (int l = 0; l < kc; ++l) {
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        acc[i][j] += a[i] * b[j];
+      }
+    }
+    a += 4;
+    b += 4;
+  }
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      c[i * ldc + j] += alpha * acc[i][j];
+    }
+  }
+}
+
+/**
+ * Parses the S21_SIMD environment variable, which caps the dispatched
+ * instruction set (scalar, sse2, avx2 or avx512).
+ */
+SimdLevel SimdLevelLimit() noexcept {
+  const char* limit = std::getenv("S21_SIMD");
+  if (!limit) return SimdLevel::kAvx512;
+  if (!std::strcmp(limit, "scalar")) return SimdLevel::kScalar;
+  if (!std::strcmp(limit, "sse2")) return SimdLevel::kSse2;
+  if (!std::strcmp(limit, "avx2")) return SimdLevel::kAvx2;
+  return SimdLevel::kAvx512;
+}
+
+template <class T>
+const BasicKernelTable<T>& SelectKernels() noexcept {
+  SimdLevel level = DetectSimdLevel();
+  const SimdLevel limit = SimdLevelLimit();
+  if (limit < level) level = limit;
+
+  for (;; level = static_cast<SimdLevel>(static_cast<int>(level) - 1)) {
+    if (const BasicKernelTable<T>* table = KernelsFor<T>(level)) return *table;
+  }
+}
+
+}  // namespace
+
+/**
+ * Returns the portable kernel table.
+ */
+template <class T>
+const BasicKernelTable<T>& ScalarKernels() noexcept {
+  static const BasicKernelTable<T> table{
+      SimdLevel::kScalar, {4, 4, MicroKernelScalar4x4<T>},
+      AddScalar<T>,       SubScalar<T>,
+      ScaleScalar<T>,     AxpyScalar<T>,
+      TransposeScalar<T>};
+  return table;
+}
+
+/**
+ * Detects the widest instruction set supported by both the CPU and the OS.
+ */
+SimdLevel DetectSimdLevel() noexcept {
+#ifdef S21_KERNELS_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return SimdLevel::kAvx2;
+  }
+  if (__builtin_cpu_supports("sse2")) return SimdLevel::kSse2;
+#endif
+  return SimdLevel::kScalar;
+}
+
+/**
+ * Returns the kernel table for the given instruction set.
+ *
+ * @return nullptr if the table is not built or the CPU does not support it
+ */
+template <class T>
+const BasicKernelTable<T>* KernelsFor(SimdLevel level) noexcept {
+  if (level > DetectSimdLevel()) return nullptr;
+  switch (level) {
+    case SimdLevel::kAvx512:
+      return Avx512Kernels<T>();
+    case SimdLevel::kAvx2:
+      return Avx2Kernels<T>();
+    case SimdLevel::kSse2:
+      return Sse2Kernels<T>();
+    default:
+      return &ScalarKernels<T>();
+  }
+}
+
+/**
+ * Returns the kernels selected for this host, resolved once per element
+ * type.
+ */
+template <class T>
+const BasicKernelTable<T>& Kernels() noexcept {
+  static const BasicKernelTable<T>& table = SelectKernels<T>();
+  return table;
+}
+
+#define S21_INSTANTIATE_KERNELS(T)                                       \
+  template const BasicKernelTable<T>& ScalarKernels<T>() noexcept;       \
+  template const BasicKernelTable<T>* KernelsFor<T>(SimdLevel) noexcept; \
+  template const BasicKernelTable<T>& Kernels<T>() noexcept;
+
+S21_INSTANTIATE_KERNELS(float)
+S21_INSTANTIATE_KERNELS(double)
+S21_INSTANTIATE_KERNELS(long double)
+S21_INSTANTIATE_KERNELS(int)
+S21_INSTANTIATE_KERNELS(long long)
+S21_INSTANTIATE_KERNELS(std::complex<float>)
+S21_INSTANTIATE_KERNELS(std::complex<double>)
+
+}  // namespace internal
+}  // namespace S21
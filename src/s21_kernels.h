@@ -0,0 +1,104 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_kernels.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the SIMD compute kernels of the
+ * CPP1_s21_matrixplus project and of their runtime dispatch.
+ *
+ * @details Every instruction set gets its own translation unit compiled with
+ * function-level target attributes, so one library runs on any x86-64 host
+ * and picks the widest kernels the CPU supports at the first call. Tables
+ * are per element type: float and double have SIMD kernels, complex<float>
+ * and complex<double> have AVX2 ones, the other element types of
+ * BasicMatrix use the portable ones.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_KERNELS_H_
+#define CPP1_S21_MATRIXPLUS_S21_KERNELS_H_
+
+#include <complex>  // std::complex
+#include <cstddef>  // std::ptrdiff_t
+
+#include "s21_gemm.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_KERNELS_X86 1
+#endif
+
+namespace S21 {
+namespace internal {
+
+enum class SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+template <class T>
+struct BasicKernelTable {
+  SimdLevel level;
+  BasicGemmKernel<T> gemm;
+  // y[0..n) += x[0..n)
+  void (*add)(std::ptrdiff_t n, const T* x, T* y);
+  // y[0..n) -= x[0..n)
+  void (*sub)(std::ptrdiff_t n, const T* x, T* y);
+  // y[0..n) *= alpha
+  void (*scale)(std::ptrdiff_t n, T alpha, T* y);
+  // y[0..n) += alpha * x[0..n)
+  void (*axpy)(std::ptrdiff_t n, T alpha, const T* x, T* y);
+  // b[j][i] = a[i][j] for a rows x cols block of a
+  void (*transpose)(int rows, int cols, const T* a, std::ptrdiff_t lda, T* b,
+                    std::ptrdiff_t ldb);
+};
+
+using KernelTable = BasicKernelTable<double>;
+
+template <class T = double>
+const BasicKernelTable<T>& Kernels() noexcept;
+template <class T = double>
+const BasicKernelTable<T>* KernelsFor(SimdLevel level) noexcept;
+SimdLevel DetectSimdLevel() noexcept;
+
+// Per instruction set tables, nullptr when not built for this architecture
+// or for this element type
+template <class T = double>
+const BasicKernelTable<T>& ScalarKernels() noexcept;
+template <class T = double>
+const BasicKernelTable<T>* Sse2Kernels() noexcept {
+  return nullptr;
+}
+template <class T = double>
+const BasicKernelTable<T>* Avx2Kernels() noexcept {
+  return nullptr;
+}
+template <class T = double>
+const BasicKernelTable<T>* Avx512Kernels() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<float>* Sse2Kernels<float>() noexcept;
+template <>
+const BasicKernelTable<double>* Sse2Kernels<double>() noexcept;
+template <>
+const BasicKernelTable<float>* Avx2Kernels<float>() noexcept;
+template <>
+const BasicKernelTable<double>* Avx2Kernels<double>() noexcept;
+template <>
+const BasicKernelTable<std::complex<float>>*
+Avx2Kernels<std::complex<float>>() noexcept;
+template <>
+const BasicKernelTable<std::complex<double>>*
+Avx2Kernels<std::complex<double>>() noexcept;
+template <>
+const BasicKernelTable<float>* Avx512Kernels<float>() noexcept;
+template <>
+const BasicKernelTable<double>* Avx512Kernels<double>() noexcept;
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_KERNELS_H_
@@ -0,0 +1,687 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_kernels_avx2.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief AVX2 + FMA kernels of the CPP1_s21_matrixplus project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_kernels.h"
+
+#ifdef S21_KERNELS_X86
+
+#include <immintrin.h>
+
+#define S21_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+S21_TARGET_AVX2 void AddAvx2(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i),
+                                          _mm256_loadu_pd(x + i)));
+    _mm256_storeu_pd(y + i + 4, _mm256_add_pd(_mm256_loadu_pd(y + i + 4),
+                                              _mm256_loadu_pd(x + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] += x[i];
+  }
+}
+
+S21_TARGET_AVX2 void SubAvx2(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(y + i, _mm256_sub_pd(_mm256_loadu_pd(y + i),
+                                          _mm256_loadu_pd(x + i)));
+    _mm256_storeu_pd(y + i + 4, _mm256_sub_pd(_mm256_loadu_pd(y + i + 4),
+                                              _mm256_loadu_pd(x + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] -= x[i];
+  }
+}
+
+S21_TARGET_AVX2 void ScaleAvx2(std::ptrdiff_t n, double alpha, double* y) {
+  const __m256d va = _mm256_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(y + i, _mm256_mul_pd(_mm256_loadu_pd(y + i), va));
+    _mm256_storeu_pd(y + i + 4, _mm256_mul_pd(_mm256_loadu_pd(y + i + 4), va));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_AVX2 void AxpyAvx2(std::ptrdiff_t n, double alpha, const double* x,
+                              double* y) {
+  const __m256d va = _mm256_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(y + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                            _mm256_loadu_pd(y + i)));
+    _mm256_storeu_pd(y + i + 4,
+                     _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i + 4),
+                                     _mm256_loadu_pd(y + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes a 4x4 block of 64-bit elements in registers. The shuffles
+ * move bits only, so it serves complex<float> elements as well.
+ */
+S21_TARGET_AVX2 void Transpose4x4Avx2(const double* a, std::ptrdiff_t lda,
+                                      double* b, std::ptrdiff_t ldb) {
+  const __m256d r0 = _mm256_loadu_pd(a);
+  const __m256d r1 = _mm256_loadu_pd(a + lda);
+  const __m256d r2 = _mm256_loadu_pd(a + 2 * lda);
+  const __m256d r3 = _mm256_loadu_pd(a + 3 * lda);
+  const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+  _mm256_storeu_pd(b, _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(b + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(b + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(b + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+/**
+ * Transposes with 4x4 in-register shuffles, scalar on the edges.
+ */
+S21_TARGET_AVX2 void TransposeAvx2(int rows, int cols, const double* a,
+                                   std::ptrdiff_t lda, double* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const double* a0 = a + i * lda;
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      Transpose4x4Avx2(a0 + j, lda, b + j * ldb + i, ldb);
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 4; ++r) {
+        b[j * ldb + i + r] = a0[r * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 6x8 micro-kernel holding C in twelve 4-wide registers.
+ */
+S21_TARGET_AVX2 void MicroKernelAvx2(int kc, const double* a, const double* b,
+                                     double* c, std::ptrdiff_t ldc,
+                                     double alpha) {
+  __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+  __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+  __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+  __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+  __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b + 4);
+    __m256d ai = _mm256_broadcast_sd(a);
+    c00 = _mm256_fmadd_pd(ai, b0, c00);
+    c01 = _mm256_fmadd_pd(ai, b1, c01);
+    ai = _mm256_broadcast_sd(a + 1);
+    c10 = _mm256_fmadd_pd(ai, b0, c10);
+    c11 = _mm256_fmadd_pd(ai, b1, c11);
+    ai = _mm256_broadcast_sd(a + 2);
+    c20 = _mm256_fmadd_pd(ai, b0, c20);
+    c21 = _mm256_fmadd_pd(ai, b1, c21);
+    ai = _mm256_broadcast_sd(a + 3);
+    c30 = _mm256_fmadd_pd(ai, b0, c30);
+    c31 = _mm256_fmadd_pd(ai, b1, c31);
+    ai = _mm256_broadcast_sd(a + 4);
+    c40 = _mm256_fmadd_pd(ai, b0, c40);
+    c41 = _mm256_fmadd_pd(ai, b1, c41);
+    ai = _mm256_broadcast_sd(a + 5);
+    c50 = _mm256_fmadd_pd(ai, b0, c50);
+    c51 = _mm256_fmadd_pd(ai, b1, c51);
+    a += 6;
+    b += 8;
+  }
+
+  const __m256d va = _mm256_set1_pd(alpha);
+  const __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                             {c30, c31}, {c40, c41}, {c50, c51}};
+  for (int i = 0; i < 6; ++i) {
+    double* row = c + i * ldc;
+    _mm256_storeu_pd(row, _mm256_fmadd_pd(va, acc[i][0], _mm256_loadu_pd(row)));
+    _mm256_storeu_pd(
+        row + 4, _mm256_fmadd_pd(va, acc[i][1], _mm256_loadu_pd(row + 4)));
+  }
+}
+
+S21_TARGET_AVX2 void AddAvx2(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i),
+                                          _mm256_loadu_ps(x + i)));
+    _mm256_storeu_ps(y + i + 8, _mm256_add_ps(_mm256_loadu_ps(y + i + 8),
+                                              _mm256_loadu_ps(x + i + 8)));
+  }
+  for (; i < n; ++i) {
+    y[i] += x[i];
+  }
+}
+
+S21_TARGET_AVX2 void SubAvx2(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_sub_ps(_mm256_loadu_ps(y + i),
+                                          _mm256_loadu_ps(x + i)));
+    _mm256_storeu_ps(y + i + 8, _mm256_sub_ps(_mm256_loadu_ps(y + i + 8),
+                                              _mm256_loadu_ps(x + i + 8)));
+  }
+  for (; i < n; ++i) {
+    y[i] -= x[i];
+  }
+}
+
+S21_TARGET_AVX2 void ScaleAvx2(std::ptrdiff_t n, float alpha, float* y) {
+  const __m256 va = _mm256_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), va));
+    _mm256_storeu_ps(y + i + 8, _mm256_mul_ps(_mm256_loadu_ps(y + i + 8), va));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_AVX2 void AxpyAvx2(std::ptrdiff_t n, float alpha, const float* x,
+                              float* y) {
+  const __m256 va = _mm256_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i),
+                                            _mm256_loadu_ps(y + i)));
+    _mm256_storeu_ps(y + i + 8,
+                     _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i + 8),
+                                     _mm256_loadu_ps(y + i + 8)));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes 8x8 float blocks with in-register shuffles, scalar on the
+ * edges.
+ */
+S21_TARGET_AVX2 void TransposeAvx2(int rows, int cols, const float* a,
+                                   std::ptrdiff_t lda, float* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 8 <= rows; i += 8) {
+    const float* a0 = a + i * lda;
+    int j = 0;
+    for (; j + 8 <= cols; j += 8) {
+      __m256 t[8], u[8];
+      for (int r = 0; r < 8; r += 2) {
+        const __m256 r0 = _mm256_loadu_ps(a0 + r * lda + j);
+        const __m256 r1 = _mm256_loadu_ps(a0 + (r + 1) * lda + j);
+        t[r] = _mm256_unpacklo_ps(r0, r1);
+        t[r + 1] = _mm256_unpackhi_ps(r0, r1);
+      }
+      for (int r = 0; r < 8; r += 4) {
+        u[r] = _mm256_shuffle_ps(t[r], t[r + 2], 0x44);
+        u[r + 1] = _mm256_shuffle_ps(t[r], t[r + 2], 0xEE);
+        u[r + 2] = _mm256_shuffle_ps(t[r + 1], t[r + 3], 0x44);
+        u[r + 3] = _mm256_shuffle_ps(t[r + 1], t[r + 3], 0xEE);
+      }
+      float* b0 = b + j * ldb + i;
+      for (int r = 0; r < 4; ++r) {
+        _mm256_storeu_ps(b0 + r * ldb,
+                         _mm256_permute2f128_ps(u[r], u[r + 4], 0x20));
+        _mm256_storeu_ps(b0 + (r + 4) * ldb,
+                         _mm256_permute2f128_ps(u[r], u[r + 4], 0x31));
+      }
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 8; ++r) {
+        b[j * ldb + i + r] = a0[r * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 6x16 float micro-kernel holding C in twelve 8-wide registers.
+ */
+S21_TARGET_AVX2 void MicroKernelAvx2(int kc, const float* a, const float* b,
+                                     float* c, std::ptrdiff_t ldc,
+                                     float alpha) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m256 b0 = _mm256_loadu_ps(b);
+    const __m256 b1 = _mm256_loadu_ps(b + 8);
+    __m256 ai = _mm256_broadcast_ss(a);
+    c00 = _mm256_fmadd_ps(ai, b0, c00);
+    c01 = _mm256_fmadd_ps(ai, b1, c01);
+    ai = _mm256_broadcast_ss(a + 1);
+    c10 = _mm256_fmadd_ps(ai, b0, c10);
+    c11 = _mm256_fmadd_ps(ai, b1, c11);
+    ai = _mm256_broadcast_ss(a + 2);
+    c20 = _mm256_fmadd_ps(ai, b0, c20);
+    c21 = _mm256_fmadd_ps(ai, b1, c21);
+    ai = _mm256_broadcast_ss(a + 3);
+    c30 = _mm256_fmadd_ps(ai, b0, c30);
+    c31 = _mm256_fmadd_ps(ai, b1, c31);
+    ai = _mm256_broadcast_ss(a + 4);
+    c40 = _mm256_fmadd_ps(ai, b0, c40);
+    c41 = _mm256_fmadd_ps(ai, b1, c41);
+    ai = _mm256_broadcast_ss(a + 5);
+    c50 = _mm256_fmadd_ps(ai, b0, c50);
+    c51 = _mm256_fmadd_ps(ai, b1, c51);
+    a += 6;
+    b += 16;
+  }
+
+  const __m256 va = _mm256_set1_ps(alpha);
+  const __m256 acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                            {c30, c31}, {c40, c41}, {c50, c51}};
+  for (int i = 0; i < 6; ++i) {
+    float* row = c + i * ldc;
+    _mm256_storeu_ps(row, _mm256_fmadd_ps(va, acc[i][0], _mm256_loadu_ps(row)));
+    _mm256_storeu_ps(
+        row + 8, _mm256_fmadd_ps(va, acc[i][1], _mm256_loadu_ps(row + 8)));
+  }
+}
+
+/****** complex<double> ******/
+
+/**
+ * alpha * v for interleaved complex lanes, alpha split into broadcast real
+ * and imaginary parts: (ar vr - ai vi, ar vi + ai vr).
+ */
+S21_TARGET_AVX2 __m256d MulComplex(__m256d ar, __m256d ai, __m256d v) {
+  return _mm256_fmaddsub_pd(ar, v,
+                            _mm256_mul_pd(ai, _mm256_permute_pd(v, 0x5)));
+}
+
+S21_TARGET_AVX2 void AddAvx2(std::ptrdiff_t n, const std::complex<double>* x,
+                             std::complex<double>* y) {
+  AddAvx2(2 * n, reinterpret_cast<const double*>(x),
+          reinterpret_cast<double*>(y));
+}
+
+S21_TARGET_AVX2 void SubAvx2(std::ptrdiff_t n, const std::complex<double>* x,
+                             std::complex<double>* y) {
+  SubAvx2(2 * n, reinterpret_cast<const double*>(x),
+          reinterpret_cast<double*>(y));
+}
+
+S21_TARGET_AVX2 void ScaleAvx2(std::ptrdiff_t n, std::complex<double> alpha,
+                               std::complex<double>* y) {
+  const __m256d ar = _mm256_set1_pd(alpha.real());
+  const __m256d ai = _mm256_set1_pd(alpha.imag());
+  double* p = reinterpret_cast<double*>(y);
+  std::ptrdiff_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm256_storeu_pd(p + 2 * i, MulComplex(ar, ai, _mm256_loadu_pd(p + 2 * i)));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_AVX2 void AxpyAvx2(std::ptrdiff_t n, std::complex<double> alpha,
+                              const std::complex<double>* x,
+                              std::complex<double>* y) {
+  const __m256d ar = _mm256_set1_pd(alpha.real());
+  const __m256d ai = _mm256_set1_pd(alpha.imag());
+  const double* px = reinterpret_cast<const double*>(x);
+  double* py = reinterpret_cast<double*>(y);
+  std::ptrdiff_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    const __m256d product = MulComplex(ar, ai, _mm256_loadu_pd(px + 2 * i));
+    _mm256_storeu_pd(py + 2 * i,
+                     _mm256_add_pd(_mm256_loadu_pd(py + 2 * i), product));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes with 2x2 blocks, one complex<double> per 128-bit lane.
+ */
+S21_TARGET_AVX2 void TransposeAvx2(int rows, int cols,
+                                   const std::complex<double>* a,
+                                   std::ptrdiff_t lda, std::complex<double>* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 2 <= rows; i += 2) {
+    const double* a0 = reinterpret_cast<const double*>(a + i * lda);
+    const double* a1 = reinterpret_cast<const double*>(a + (i + 1) * lda);
+    int j = 0;
+    for (; j + 2 <= cols; j += 2) {
+      const __m256d r0 = _mm256_loadu_pd(a0 + 2 * j);
+      const __m256d r1 = _mm256_loadu_pd(a1 + 2 * j);
+      double* b0 = reinterpret_cast<double*>(b + j * ldb + i);
+      double* b1 = reinterpret_cast<double*>(b + (j + 1) * ldb + i);
+      _mm256_storeu_pd(b0, _mm256_permute2f128_pd(r0, r1, 0x20));
+      _mm256_storeu_pd(b1, _mm256_permute2f128_pd(r0, r1, 0x31));
+    }
+    for (; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+      b[j * ldb + i + 1] = a[(i + 1) * lda + j];
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 3x4 complex<double> micro-kernel. Real and imaginary parts of A go to
+ * separate accumulators, twelve 4-wide registers in all, and meet once at
+ * the end instead of being shuffled at every step.
+ */
+S21_TARGET_AVX2 void MicroKernelAvx2(int kc, const std::complex<double>* a,
+                                     const std::complex<double>* b,
+                                     std::complex<double>* c,
+                                     std::ptrdiff_t ldc,
+                                     std::complex<double> alpha) {
+  __m256d r00 = _mm256_setzero_pd(), r01 = _mm256_setzero_pd();
+  __m256d r10 = _mm256_setzero_pd(), r11 = _mm256_setzero_pd();
+  __m256d r20 = _mm256_setzero_pd(), r21 = _mm256_setzero_pd();
+  __m256d i00 = _mm256_setzero_pd(), i01 = _mm256_setzero_pd();
+  __m256d i10 = _mm256_setzero_pd(), i11 = _mm256_setzero_pd();
+  __m256d i20 = _mm256_setzero_pd(), i21 = _mm256_setzero_pd();
+  const double* pa = reinterpret_cast<const double*>(a);
+  const double* pb = reinterpret_cast<const double*>(b);
+
+  for (int l = 0; l < kc; ++l) {
+    const __m256d b0 = _mm256_loadu_pd(pb);
+    const __m256d b1 = _mm256_loadu_pd(pb + 4);
+    __m256d ar = _mm256_broadcast_sd(pa);
+    __m256d ai = _mm256_broadcast_sd(pa + 1);
+    r00 = _mm256_fmadd_pd(ar, b0, r00);
+    r01 = _mm256_fmadd_pd(ar, b1, r01);
+    i00 = _mm256_fmadd_pd(ai, b0, i00);
+    i01 = _mm256_fmadd_pd(ai, b1, i01);
+    ar = _mm256_broadcast_sd(pa + 2);
+    ai = _mm256_broadcast_sd(pa + 3);
+    r10 = _mm256_fmadd_pd(ar, b0, r10);
+    r11 = _mm256_fmadd_pd(ar, b1, r11);
+    i10 = _mm256_fmadd_pd(ai, b0, i10);
+    i11 = _mm256_fmadd_pd(ai, b1, i11);
+    ar = _mm256_broadcast_sd(pa + 4);
+    ai = _mm256_broadcast_sd(pa + 5);
+    r20 = _mm256_fmadd_pd(ar, b0, r20);
+    r21 = _mm256_fmadd_pd(ar, b1, r21);
+    i20 = _mm256_fmadd_pd(ai, b0, i20);
+    i21 = _mm256_fmadd_pd(ai, b1, i21);
+    pa += 6;
+    pb += 8;
+  }
+
+  const __m256d va_r = _mm256_set1_pd(alpha.real());
+  const __m256d va_i = _mm256_set1_pd(alpha.imag());
+  const __m256d re[3][2] = {{r00, r01}, {r10, r11}, {r20, r21}};
+  const __m256d im[3][2] = {{i00, i01}, {i10, i11}, {i20, i21}};
+  for (int i = 0; i < 3; ++i) {
+    double* row = reinterpret_cast<double*>(c + i * ldc);
+    for (int v = 0; v < 2; ++v) {
+      // a * b = ar * b + ai * (-bi, br)
+      const __m256d ab =
+          _mm256_addsub_pd(re[i][v], _mm256_permute_pd(im[i][v], 0x5));
+      _mm256_storeu_pd(row + 4 * v,
+                       _mm256_add_pd(_mm256_loadu_pd(row + 4 * v),
+                                     MulComplex(va_r, va_i, ab)));
+    }
+  }
+}
+
+/****** complex<float> ******/
+
+S21_TARGET_AVX2 __m256 MulComplex(__m256 ar, __m256 ai, __m256 v) {
+  return _mm256_fmaddsub_ps(ar, v,
+                            _mm256_mul_ps(ai, _mm256_permute_ps(v, 0xB1)));
+}
+
+S21_TARGET_AVX2 void AddAvx2(std::ptrdiff_t n, const std::complex<float>* x,
+                             std::complex<float>* y) {
+  AddAvx2(2 * n, reinterpret_cast<const float*>(x),
+          reinterpret_cast<float*>(y));
+}
+
+S21_TARGET_AVX2 void SubAvx2(std::ptrdiff_t n, const std::complex<float>* x,
+                             std::complex<float>* y) {
+  SubAvx2(2 * n, reinterpret_cast<const float*>(x),
+          reinterpret_cast<float*>(y));
+}
+
+S21_TARGET_AVX2 void ScaleAvx2(std::ptrdiff_t n, std::complex<float> alpha,
+                               std::complex<float>* y) {
+  const __m256 ar = _mm256_set1_ps(alpha.real());
+  const __m256 ai = _mm256_set1_ps(alpha.imag());
+  float* p = reinterpret_cast<float*>(y);
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_ps(p + 2 * i, MulComplex(ar, ai, _mm256_loadu_ps(p + 2 * i)));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_AVX2 void AxpyAvx2(std::ptrdiff_t n, std::complex<float> alpha,
+                              const std::complex<float>* x,
+                              std::complex<float>* y) {
+  const __m256 ar = _mm256_set1_ps(alpha.real());
+  const __m256 ai = _mm256_set1_ps(alpha.imag());
+  const float* px = reinterpret_cast<const float*>(x);
+  float* py = reinterpret_cast<float*>(y);
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256 product = MulComplex(ar, ai, _mm256_loadu_ps(px + 2 * i));
+    _mm256_storeu_ps(py + 2 * i,
+                     _mm256_add_ps(_mm256_loadu_ps(py + 2 * i), product));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes 4x4 blocks of complex<float> as 64-bit lanes, element by
+ * element on the edges.
+ */
+S21_TARGET_AVX2 void TransposeAvx2(int rows, int cols,
+                                   const std::complex<float>* a,
+                                   std::ptrdiff_t lda, std::complex<float>* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      Transpose4x4Avx2(reinterpret_cast<const double*>(a + i * lda + j), lda,
+                       reinterpret_cast<double*>(b + j * ldb + i), ldb);
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 4; ++r) {
+        b[j * ldb + i + r] = a[(i + r) * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 3x8 complex<float> micro-kernel, laid out like the complex<double> one.
+ */
+S21_TARGET_AVX2 void MicroKernelAvx2(int kc, const std::complex<float>* a,
+                                     const std::complex<float>* b,
+                                     std::complex<float>* c, std::ptrdiff_t ldc,
+                                     std::complex<float> alpha) {
+  __m256 r00 = _mm256_setzero_ps(), r01 = _mm256_setzero_ps();
+  __m256 r10 = _mm256_setzero_ps(), r11 = _mm256_setzero_ps();
+  __m256 r20 = _mm256_setzero_ps(), r21 = _mm256_setzero_ps();
+  __m256 i00 = _mm256_setzero_ps(), i01 = _mm256_setzero_ps();
+  __m256 i10 = _mm256_setzero_ps(), i11 = _mm256_setzero_ps();
+  __m256 i20 = _mm256_setzero_ps(), i21 = _mm256_setzero_ps();
+  const float* pa = reinterpret_cast<const float*>(a);
+  const float* pb = reinterpret_cast<const float*>(b);
+
+  for (int l = 0; l < kc; ++l) {
+    const __m256 b0 = _mm256_loadu_ps(pb);
+    const __m256 b1 = _mm256_loadu_ps(pb + 8);
+    __m256 ar = _mm256_broadcast_ss(pa);
+    __m256 ai = _mm256_broadcast_ss(pa + 1);
+    r00 = _mm256_fmadd_ps(ar, b0, r00);
+    r01 = _mm256_fmadd_ps(ar, b1, r01);
+    i00 = _mm256_fmadd_ps(ai, b0, i00);
+    i01 = _mm256_fmadd_ps(ai, b1, i01);
+    ar = _mm256_broadcast_ss(pa + 2);
+    ai = _mm256_broadcast_ss(pa + 3);
+    r10 = _mm256_fmadd_ps(ar, b0, r10);
+    r11 = _mm256_fmadd_ps(ar, b1, r11);
+    i10 = _mm256_fmadd_ps(ai, b0, i10);
+    i11 = _mm256_fmadd_ps(ai, b1, i11);
+    ar = _mm256_broadcast_ss(pa + 4);
+    ai = _mm256_broadcast_ss(pa + 5);
+    r20 = _mm256_fmadd_ps(ar, b0, r20);
+    r21 = _mm256_fmadd_ps(ar, b1, r21);
+    i20 = _mm256_fmadd_ps(ai, b0, i20);
+    i21 = _mm256_fmadd_ps(ai, b1, i21);
+    pa += 6;
+    pb += 16;
+  }
+
+  const __m256 va_r = _mm256_set1_ps(alpha.real());
+  const __m256 va_i = _mm256_set1_ps(alpha.imag());
+  const __m256 re[3][2] = {{r00, r01}, {r10, r11}, {r20, r21}};
+  const __m256 im[3][2] = {{i00, i01}, {i10, i11}, {i20, i21}};
+  for (int i = 0; i < 3; ++i) {
+    float* row = reinterpret_cast<float*>(c + i * ldc);
+    for (int v = 0; v < 2; ++v) {
+      const __m256 ab =
+          _mm256_addsub_ps(re[i][v], _mm256_permute_ps(im[i][v], 0xB1));
+      _mm256_storeu_ps(row + 8 * v,
+                       _mm256_add_ps(_mm256_loadu_ps(row + 8 * v),
+                                     MulComplex(va_r, va_i, ab)));
+    }
+  }
+}
+
+}  // namespace
+
+template <>
+const BasicKernelTable<float>* Avx2Kernels<float>() noexcept {
+  static const BasicKernelTable<float> table{
+      SimdLevel::kAvx2, {6, 16, MicroKernelAvx2},
+      AddAvx2,          SubAvx2,
+      ScaleAvx2,        AxpyAvx2,
+      TransposeAvx2};
+  return &table;
+}
+
+template <>
+const BasicKernelTable<double>* Avx2Kernels<double>() noexcept {
+  static const KernelTable table{
+      SimdLevel::kAvx2, {6, 8, MicroKernelAvx2},
+      AddAvx2,          SubAvx2,
+      ScaleAvx2,        AxpyAvx2,
+      TransposeAvx2};
+  return &table;
+}
+
+template <>
+const BasicKernelTable<std::complex<float>>*
+Avx2Kernels<std::complex<float>>() noexcept {
+  static const BasicKernelTable<std::complex<float>> table{
+      SimdLevel::kAvx2, {3, 8, MicroKernelAvx2},
+      AddAvx2,          SubAvx2,
+      ScaleAvx2,        AxpyAvx2,
+      TransposeAvx2};
+  return &table;
+}
+
+template <>
+const BasicKernelTable<std::complex<double>>*
+Avx2Kernels<std::complex<double>>() noexcept {
+  static const BasicKernelTable<std::complex<double>> table{
+      SimdLevel::kAvx2, {3, 4, MicroKernelAvx2},
+      AddAvx2,          SubAvx2,
+      ScaleAvx2,        AxpyAvx2,
+      TransposeAvx2};
+  return &table;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#else  // S21_KERNELS_X86
+
+namespace S21 {
+namespace internal {
+
+template <>
+const BasicKernelTable<float>* Avx2Kernels<float>() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<double>* Avx2Kernels<double>() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<std::complex<float>>*
+Avx2Kernels<std::complex<float>>() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<std::complex<double>>*
+Avx2Kernels<std::complex<double>>() noexcept {
+  return nullptr;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // S21_KERNELS_X86
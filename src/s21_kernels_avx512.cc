@@ -0,0 +1,422 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_kernels_avx512.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief AVX-512 kernels of the CPP1_s21_matrixplus project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_kernels.h"
+
+#ifdef S21_KERNELS_X86
+
+#include <immintrin.h>
+
+#define S21_TARGET_AVX512 __attribute__((target("avx512f")))
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+S21_TARGET_AVX512 inline __mmask8 TailMask(std::ptrdiff_t count) {
+  return static_cast<__mmask8>((1u << count) - 1u);
+}
+
+S21_TARGET_AVX512 inline __mmask16 TailMask16(std::ptrdiff_t count) {
+  return static_cast<__mmask16>((1u << count) - 1u);
+}
+
+S21_TARGET_AVX512 void AddAvx512(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_add_pd(_mm512_loadu_pd(y + i),
+                                          _mm512_loadu_pd(x + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = TailMask(n - i);
+    _mm512_mask_storeu_pd(y + i, m,
+                          _mm512_add_pd(_mm512_maskz_loadu_pd(m, y + i),
+                                        _mm512_maskz_loadu_pd(m, x + i)));
+  }
+}
+
+S21_TARGET_AVX512 void SubAvx512(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_sub_pd(_mm512_loadu_pd(y + i),
+                                          _mm512_loadu_pd(x + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = TailMask(n - i);
+    _mm512_mask_storeu_pd(y + i, m,
+                          _mm512_sub_pd(_mm512_maskz_loadu_pd(m, y + i),
+                                        _mm512_maskz_loadu_pd(m, x + i)));
+  }
+}
+
+S21_TARGET_AVX512 void ScaleAvx512(std::ptrdiff_t n, double alpha, double* y) {
+  const __m512d va = _mm512_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_mul_pd(_mm512_loadu_pd(y + i), va));
+  }
+  if (i < n) {
+    const __mmask8 m = TailMask(n - i);
+    _mm512_mask_storeu_pd(y + i, m,
+                          _mm512_mul_pd(_mm512_maskz_loadu_pd(m, y + i), va));
+  }
+}
+
+S21_TARGET_AVX512 void AxpyAvx512(std::ptrdiff_t n, double alpha,
+                                  const double* x, double* y) {
+  const __m512d va = _mm512_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i),
+                                            _mm512_loadu_pd(y + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = TailMask(n - i);
+    _mm512_mask_storeu_pd(
+        y + i, m,
+        _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, x + i),
+                        _mm512_maskz_loadu_pd(m, y + i)));
+  }
+}
+
+// The unmasked unpack and shuffle intrinsics merge into _mm512_undefined_pd(),
+// which GCC 12 reports as possibly uninitialized. A full mask over a zero
+// source compiles to the same instructions.
+S21_TARGET_AVX512 inline __m512d UnpackLo(__m512d a, __m512d b) {
+  return _mm512_maskz_unpacklo_pd(0xFF, a, b);
+}
+
+S21_TARGET_AVX512 inline __m512d UnpackHi(__m512d a, __m512d b) {
+  return _mm512_maskz_unpackhi_pd(0xFF, a, b);
+}
+
+template <int kImm>
+S21_TARGET_AVX512 inline __m512d Shuffle128(__m512d a, __m512d b) {
+  return _mm512_maskz_shuffle_f64x2(0xFF, a, b, kImm);
+}
+
+/**
+ * Transposes with 8x8 in-register shuffles, scalar on the edges.
+ */
+S21_TARGET_AVX512 void TransposeAvx512(int rows, int cols, const double* a,
+                                       std::ptrdiff_t lda, double* b,
+                                       std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 8 <= rows; i += 8) {
+    const double* a0 = a + i * lda;
+    int j = 0;
+    for (; j + 8 <= cols; j += 8) {
+      __m512d t[8];
+      for (int r = 0; r < 8; r += 2) {
+        const __m512d r0 = _mm512_loadu_pd(a0 + r * lda + j);
+        const __m512d r1 = _mm512_loadu_pd(a0 + (r + 1) * lda + j);
+        t[r] = UnpackLo(r0, r1);
+        t[r + 1] = UnpackHi(r0, r1);
+      }
+      const __m512d u0 = Shuffle128<0x88>(t[0], t[2]);
+      const __m512d u1 = Shuffle128<0xDD>(t[0], t[2]);
+      const __m512d u2 = Shuffle128<0x88>(t[1], t[3]);
+      const __m512d u3 = Shuffle128<0xDD>(t[1], t[3]);
+      const __m512d u4 = Shuffle128<0x88>(t[4], t[6]);
+      const __m512d u5 = Shuffle128<0xDD>(t[4], t[6]);
+      const __m512d u6 = Shuffle128<0x88>(t[5], t[7]);
+      const __m512d u7 = Shuffle128<0xDD>(t[5], t[7]);
+      double* b0 = b + j * ldb + i;
+      _mm512_storeu_pd(b0, Shuffle128<0x88>(u0, u4));
+      _mm512_storeu_pd(b0 + ldb, Shuffle128<0x88>(u2, u6));
+      _mm512_storeu_pd(b0 + 2 * ldb, Shuffle128<0x88>(u1, u5));
+      _mm512_storeu_pd(b0 + 3 * ldb, Shuffle128<0x88>(u3, u7));
+      _mm512_storeu_pd(b0 + 4 * ldb, Shuffle128<0xDD>(u0, u4));
+      _mm512_storeu_pd(b0 + 5 * ldb, Shuffle128<0xDD>(u2, u6));
+      _mm512_storeu_pd(b0 + 6 * ldb, Shuffle128<0xDD>(u1, u5));
+      _mm512_storeu_pd(b0 + 7 * ldb, Shuffle128<0xDD>(u3, u7));
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 8; ++r) {
+        b[j * ldb + i + r] = a0[r * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 8x16 micro-kernel holding C in sixteen 8-wide registers.
+ */
+S21_TARGET_AVX512 void MicroKernelAvx512(int kc, const double* a,
+                                         const double* b, double* c,
+                                         std::ptrdiff_t ldc, double alpha) {
+  __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+  __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+  __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+  __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+  __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+  __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+  __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+  __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m512d b0 = _mm512_loadu_pd(b);
+    const __m512d b1 = _mm512_loadu_pd(b + 8);
+    __m512d ai = _mm512_set1_pd(a[0]);
+    c00 = _mm512_fmadd_pd(ai, b0, c00);
+    c01 = _mm512_fmadd_pd(ai, b1, c01);
+    ai = _mm512_set1_pd(a[1]);
+    c10 = _mm512_fmadd_pd(ai, b0, c10);
+    c11 = _mm512_fmadd_pd(ai, b1, c11);
+    ai = _mm512_set1_pd(a[2]);
+    c20 = _mm512_fmadd_pd(ai, b0, c20);
+    c21 = _mm512_fmadd_pd(ai, b1, c21);
+    ai = _mm512_set1_pd(a[3]);
+    c30 = _mm512_fmadd_pd(ai, b0, c30);
+    c31 = _mm512_fmadd_pd(ai, b1, c31);
+    ai = _mm512_set1_pd(a[4]);
+    c40 = _mm512_fmadd_pd(ai, b0, c40);
+    c41 = _mm512_fmadd_pd(ai, b1, c41);
+    ai = _mm512_set1_pd(a[5]);
+    c50 = _mm512_fmadd_pd(ai, b0, c50);
+    c51 = _mm512_fmadd_pd(ai, b1, c51);
+    ai = _mm512_set1_pd(a[6]);
+    c60 = _mm512_fmadd_pd(ai, b0, c60);
+    c61 = _mm512_fmadd_pd(ai, b1, c61);
+    ai = _mm512_set1_pd(a[7]);
+    c70 = _mm512_fmadd_pd(ai, b0, c70);
+    c71 = _mm512_fmadd_pd(ai, b1, c71);
+    a += 8;
+    b += 16;
+  }
+
+  const __m512d va = _mm512_set1_pd(alpha);
+  const __m512d acc[8][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                             {c30, c31}, {c40, c41}, {c50, c51},
+                             {c60, c61}, {c70, c71}};
+  for (int i = 0; i < 8; ++i) {
+    double* row = c + i * ldc;
+    _mm512_storeu_pd(row, _mm512_fmadd_pd(va, acc[i][0], _mm512_loadu_pd(row)));
+    _mm512_storeu_pd(
+        row + 8, _mm512_fmadd_pd(va, acc[i][1], _mm512_loadu_pd(row + 8)));
+  }
+}
+
+S21_TARGET_AVX512 void AddAvx512(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_add_ps(_mm512_loadu_ps(y + i),
+                                          _mm512_loadu_ps(x + i)));
+  }
+  if (i < n) {
+    const __mmask16 m = TailMask16(n - i);
+    _mm512_mask_storeu_ps(y + i, m,
+                          _mm512_add_ps(_mm512_maskz_loadu_ps(m, y + i),
+                                        _mm512_maskz_loadu_ps(m, x + i)));
+  }
+}
+
+S21_TARGET_AVX512 void SubAvx512(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_sub_ps(_mm512_loadu_ps(y + i),
+                                          _mm512_loadu_ps(x + i)));
+  }
+  if (i < n) {
+    const __mmask16 m = TailMask16(n - i);
+    _mm512_mask_storeu_ps(y + i, m,
+                          _mm512_sub_ps(_mm512_maskz_loadu_ps(m, y + i),
+                                        _mm512_maskz_loadu_ps(m, x + i)));
+  }
+}
+
+S21_TARGET_AVX512 void ScaleAvx512(std::ptrdiff_t n, float alpha, float* y) {
+  const __m512 va = _mm512_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_mul_ps(_mm512_loadu_ps(y + i), va));
+  }
+  if (i < n) {
+    const __mmask16 m = TailMask16(n - i);
+    _mm512_mask_storeu_ps(y + i, m,
+                          _mm512_mul_ps(_mm512_maskz_loadu_ps(m, y + i), va));
+  }
+}
+
+S21_TARGET_AVX512 void AxpyAvx512(std::ptrdiff_t n, float alpha, const float* x,
+                                  float* y) {
+  const __m512 va = _mm512_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i),
+                                            _mm512_loadu_ps(y + i)));
+  }
+  if (i < n) {
+    const __mmask16 m = TailMask16(n - i);
+    _mm512_mask_storeu_ps(
+        y + i, m,
+        _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(m, x + i),
+                        _mm512_maskz_loadu_ps(m, y + i)));
+  }
+}
+
+/**
+ * Transposes 8x8 float blocks in 8-wide registers, scalar on the edges; a
+ * 16x16 block would need more shuffles than it saves.
+ */
+S21_TARGET_AVX512 void TransposeAvx512(int rows, int cols, const float* a,
+                                       std::ptrdiff_t lda, float* b,
+                                       std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 8 <= rows; i += 8) {
+    const float* a0 = a + i * lda;
+    int j = 0;
+    for (; j + 8 <= cols; j += 8) {
+      __m256 t[8], u[8];
+      for (int r = 0; r < 8; r += 2) {
+        const __m256 r0 = _mm256_loadu_ps(a0 + r * lda + j);
+        const __m256 r1 = _mm256_loadu_ps(a0 + (r + 1) * lda + j);
+        t[r] = _mm256_unpacklo_ps(r0, r1);
+        t[r + 1] = _mm256_unpackhi_ps(r0, r1);
+      }
+      for (int r = 0; r < 8; r += 4) {
+        u[r] = _mm256_shuffle_ps(t[r], t[r + 2], 0x44);
+        u[r + 1] = _mm256_shuffle_ps(t[r], t[r + 2], 0xEE);
+        u[r + 2] = _mm256_shuffle_ps(t[r + 1], t[r + 3], 0x44);
+        u[r + 3] = _mm256_shuffle_ps(t[r + 1], t[r + 3], 0xEE);
+      }
+      float* b0 = b + j * ldb + i;
+      for (int r = 0; r < 4; ++r) {
+        _mm256_storeu_ps(b0 + r * ldb,
+                         _mm256_permute2f128_ps(u[r], u[r + 4], 0x20));
+        _mm256_storeu_ps(b0 + (r + 4) * ldb,
+                         _mm256_permute2f128_ps(u[r], u[r + 4], 0x31));
+      }
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 8; ++r) {
+        b[j * ldb + i + r] = a0[r * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 8x32 float micro-kernel holding C in sixteen 16-wide registers.
+ */
+S21_TARGET_AVX512 void MicroKernelAvx512(int kc, const float* a, const float* b,
+                                         float* c, std::ptrdiff_t ldc,
+                                         float alpha) {
+  __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+  __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+  __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+  __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+  __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+  __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+  __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+  __m512 c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m512 b0 = _mm512_loadu_ps(b);
+    const __m512 b1 = _mm512_loadu_ps(b + 16);
+    __m512 ai = _mm512_set1_ps(a[0]);
+    c00 = _mm512_fmadd_ps(ai, b0, c00);
+    c01 = _mm512_fmadd_ps(ai, b1, c01);
+    ai = _mm512_set1_ps(a[1]);
+    c10 = _mm512_fmadd_ps(ai, b0, c10);
+    c11 = _mm512_fmadd_ps(ai, b1, c11);
+    ai = _mm512_set1_ps(a[2]);
+    c20 = _mm512_fmadd_ps(ai, b0, c20);
+    c21 = _mm512_fmadd_ps(ai, b1, c21);
+    ai = _mm512_set1_ps(a[3]);
+    c30 = _mm512_fmadd_ps(ai, b0, c30);
+    c31 = _mm512_fmadd_ps(ai, b1, c31);
+    ai = _mm512_set1_ps(a[4]);
+    c40 = _mm512_fmadd_ps(ai, b0, c40);
+    c41 = _mm512_fmadd_ps(ai, b1, c41);
+    ai = _mm512_set1_ps(a[5]);
+    c50 = _mm512_fmadd_ps(ai, b0, c50);
+    c51 = _mm512_fmadd_ps(ai, b1, c51);
+    ai = _mm512_set1_ps(a[6]);
+    c60 = _mm512_fmadd_ps(ai, b0, c60);
+    c61 = _mm512_fmadd_ps(ai, b1, c61);
+    ai = _mm512_set1_ps(a[7]);
+    c70 = _mm512_fmadd_ps(ai, b0, c70);
+    c71 = _mm512_fmadd_ps(ai, b1, c71);
+    a += 8;
+    b += 32;
+  }
+
+  const __m512 va = _mm512_set1_ps(alpha);
+  const __m512 acc[8][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                            {c30, c31}, {c40, c41}, {c50, c51},
+                            {c60, c61}, {c70, c71}};
+  for (int i = 0; i < 8; ++i) {
+    float* row = c + i * ldc;
+    _mm512_storeu_ps(row, _mm512_fmadd_ps(va, acc[i][0], _mm512_loadu_ps(row)));
+    _mm512_storeu_ps(
+        row + 16, _mm512_fmadd_ps(va, acc[i][1], _mm512_loadu_ps(row + 16)));
+  }
+}
+
+}  // namespace
+
+template <>
+const BasicKernelTable<float>* Avx512Kernels<float>() noexcept {
+  static const BasicKernelTable<float> table{
+      SimdLevel::kAvx512, {8, 32, MicroKernelAvx512},
+      AddAvx512,          SubAvx512,
+      ScaleAvx512,        AxpyAvx512,
+      TransposeAvx512};
+  return &table;
+}
+
+template <>
+const BasicKernelTable<double>* Avx512Kernels<double>() noexcept {
+  static const KernelTable table{
+      SimdLevel::kAvx512, {8, 16, MicroKernelAvx512},
+      AddAvx512,          SubAvx512,
+      ScaleAvx512,        AxpyAvx512,
+      TransposeAvx512};
+  return &table;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#else  // S21_KERNELS_X86
+
+namespace S21 {
+namespace internal {
+
+template <>
+const BasicKernelTable<float>* Avx512Kernels<float>() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<double>* Avx512Kernels<double>() noexcept {
+  return nullptr;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // S21_KERNELS_X86
@@ -0,0 +1,324 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_kernels_sse2.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief SSE2 kernels of the CPP1_s21_matrixplus project, the x86-64
+ * baseline.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_kernels.h"
+
+#ifdef S21_KERNELS_X86
+
+#include <emmintrin.h>
+#include <xmmintrin.h>
+
+#define S21_TARGET_SSE2 __attribute__((target("sse2")))
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+S21_TARGET_SSE2 void AddSse2(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(x + i)));
+    _mm_storeu_pd(y + i + 2,
+                  _mm_add_pd(_mm_loadu_pd(y + i + 2), _mm_loadu_pd(x + i + 2)));
+  }
+  for (; i < n; ++i) {
+    y[i] += x[i];
+  }
+}
+
+S21_TARGET_SSE2 void SubSse2(std::ptrdiff_t n, const double* x, double* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd(y + i, _mm_sub_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(x + i)));
+    _mm_storeu_pd(y + i + 2,
+                  _mm_sub_pd(_mm_loadu_pd(y + i + 2), _mm_loadu_pd(x + i + 2)));
+  }
+  for (; i < n; ++i) {
+    y[i] -= x[i];
+  }
+}
+
+S21_TARGET_SSE2 void ScaleSse2(std::ptrdiff_t n, double alpha, double* y) {
+  const __m128d va = _mm_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd(y + i, _mm_mul_pd(_mm_loadu_pd(y + i), va));
+    _mm_storeu_pd(y + i + 2, _mm_mul_pd(_mm_loadu_pd(y + i + 2), va));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_SSE2 void AxpySse2(std::ptrdiff_t n, double alpha, const double* x,
+                              double* y) {
+  const __m128d va = _mm_set1_pd(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i),
+                                    _mm_mul_pd(va, _mm_loadu_pd(x + i))));
+    _mm_storeu_pd(y + i + 2,
+                  _mm_add_pd(_mm_loadu_pd(y + i + 2),
+                             _mm_mul_pd(va, _mm_loadu_pd(x + i + 2))));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes with 2x2 in-register shuffles, scalar on the odd edges.
+ */
+S21_TARGET_SSE2 void TransposeSse2(int rows, int cols, const double* a,
+                                   std::ptrdiff_t lda, double* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 2 <= rows; i += 2) {
+    const double* a0 = a + i * lda;
+    const double* a1 = a0 + lda;
+    int j = 0;
+    for (; j + 2 <= cols; j += 2) {
+      const __m128d r0 = _mm_loadu_pd(a0 + j);
+      const __m128d r1 = _mm_loadu_pd(a1 + j);
+      _mm_storeu_pd(b + j * ldb + i, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(b + (j + 1) * ldb + i, _mm_unpackhi_pd(r0, r1));
+    }
+    for (; j < cols; ++j) {
+      b[j * ldb + i] = a0[j];
+      b[j * ldb + i + 1] = a1[j];
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 4x4 micro-kernel holding C in eight 2-wide registers.
+ */
+S21_TARGET_SSE2 void MicroKernelSse2(int kc, const double* a, const double* b,
+                                     double* c, std::ptrdiff_t ldc,
+                                     double alpha) {
+  __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd();
+  __m128d c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+  __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd();
+  __m128d c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m128d b0 = _mm_loadu_pd(b);
+    const __m128d b1 = _mm_loadu_pd(b + 2);
+    __m128d ai = _mm_load1_pd(a);
+    c00 = _mm_add_pd(c00, _mm_mul_pd(ai, b0));
+    c01 = _mm_add_pd(c01, _mm_mul_pd(ai, b1));
+    ai = _mm_load1_pd(a + 1);
+    c10 = _mm_add_pd(c10, _mm_mul_pd(ai, b0));
+    c11 = _mm_add_pd(c11, _mm_mul_pd(ai, b1));
+    ai = _mm_load1_pd(a + 2);
+    c20 = _mm_add_pd(c20, _mm_mul_pd(ai, b0));
+    c21 = _mm_add_pd(c21, _mm_mul_pd(ai, b1));
+    ai = _mm_load1_pd(a + 3);
+    c30 = _mm_add_pd(c30, _mm_mul_pd(ai, b0));
+    c31 = _mm_add_pd(c31, _mm_mul_pd(ai, b1));
+    a += 4;
+    b += 4;
+  }
+
+  const __m128d va = _mm_set1_pd(alpha);
+  const __m128d acc[4][2] = {
+      {c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}};
+  for (int i = 0; i < 4; ++i) {
+    double* row = c + i * ldc;
+    _mm_storeu_pd(row,
+                  _mm_add_pd(_mm_loadu_pd(row), _mm_mul_pd(va, acc[i][0])));
+    _mm_storeu_pd(row + 2, _mm_add_pd(_mm_loadu_pd(row + 2),
+                                      _mm_mul_pd(va, acc[i][1])));
+  }
+}
+
+S21_TARGET_SSE2 void AddSse2(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    _mm_storeu_ps(y + i + 4,
+                  _mm_add_ps(_mm_loadu_ps(y + i + 4), _mm_loadu_ps(x + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] += x[i];
+  }
+}
+
+S21_TARGET_SSE2 void SubSse2(std::ptrdiff_t n, const float* x, float* y) {
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_ps(y + i, _mm_sub_ps(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    _mm_storeu_ps(y + i + 4,
+                  _mm_sub_ps(_mm_loadu_ps(y + i + 4), _mm_loadu_ps(x + i + 4)));
+  }
+  for (; i < n; ++i) {
+    y[i] -= x[i];
+  }
+}
+
+S21_TARGET_SSE2 void ScaleSse2(std::ptrdiff_t n, float alpha, float* y) {
+  const __m128 va = _mm_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_ps(y + i, _mm_mul_ps(_mm_loadu_ps(y + i), va));
+    _mm_storeu_ps(y + i + 4, _mm_mul_ps(_mm_loadu_ps(y + i + 4), va));
+  }
+  for (; i < n; ++i) {
+    y[i] *= alpha;
+  }
+}
+
+S21_TARGET_SSE2 void AxpySse2(std::ptrdiff_t n, float alpha, const float* x,
+                              float* y) {
+  const __m128 va = _mm_set1_ps(alpha);
+  std::ptrdiff_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i),
+                                    _mm_mul_ps(va, _mm_loadu_ps(x + i))));
+    _mm_storeu_ps(y + i + 4,
+                  _mm_add_ps(_mm_loadu_ps(y + i + 4),
+                             _mm_mul_ps(va, _mm_loadu_ps(x + i + 4))));
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+/**
+ * Transposes 4x4 float blocks in registers, scalar on the edges.
+ */
+S21_TARGET_SSE2 void TransposeSse2(int rows, int cols, const float* a,
+                                   std::ptrdiff_t lda, float* b,
+                                   std::ptrdiff_t ldb) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const float* a0 = a + i * lda;
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      __m128 r0 = _mm_loadu_ps(a0 + j);
+      __m128 r1 = _mm_loadu_ps(a0 + lda + j);
+      __m128 r2 = _mm_loadu_ps(a0 + 2 * lda + j);
+      __m128 r3 = _mm_loadu_ps(a0 + 3 * lda + j);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      _mm_storeu_ps(b + j * ldb + i, r0);
+      _mm_storeu_ps(b + (j + 1) * ldb + i, r1);
+      _mm_storeu_ps(b + (j + 2) * ldb + i, r2);
+      _mm_storeu_ps(b + (j + 3) * ldb + i, r3);
+    }
+    for (; j < cols; ++j) {
+      for (int r = 0; r < 4; ++r) {
+        b[j * ldb + i + r] = a0[r * lda + j];
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      b[j * ldb + i] = a[i * lda + j];
+    }
+  }
+}
+
+/**
+ * 4x8 float micro-kernel holding C in eight 4-wide registers.
+ */
+S21_TARGET_SSE2 void MicroKernelSse2(int kc, const float* a, const float* b,
+                                     float* c, std::ptrdiff_t ldc,
+                                     float alpha) {
+  __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+  __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+  __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+  __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+
+  for (int l = 0; l < kc; ++l) {
+    const __m128 b0 = _mm_loadu_ps(b);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    __m128 ai = _mm_set1_ps(a[0]);
+    c00 = _mm_add_ps(c00, _mm_mul_ps(ai, b0));
+    c01 = _mm_add_ps(c01, _mm_mul_ps(ai, b1));
+    ai = _mm_set1_ps(a[1]);
+    c10 = _mm_add_ps(c10, _mm_mul_ps(ai, b0));
+    c11 = _mm_add_ps(c11, _mm_mul_ps(ai, b1));
+    ai = _mm_set1_ps(a[2]);
+    c20 = _mm_add_ps(c20, _mm_mul_ps(ai, b0));
+    c21 = _mm_add_ps(c21, _mm_mul_ps(ai, b1));
+    ai = _mm_set1_ps(a[3]);
+    c30 = _mm_add_ps(c30, _mm_mul_ps(ai, b0));
+    c31 = _mm_add_ps(c31, _mm_mul_ps(ai, b1));
+    a += 4;
+    b += 8;
+  }
+
+  const __m128 va = _mm_set1_ps(alpha);
+  const __m128 acc[4][2] = {
+      {c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}};
+  for (int i = 0; i < 4; ++i) {
+    float* row = c + i * ldc;
+    _mm_storeu_ps(row,
+                  _mm_add_ps(_mm_loadu_ps(row), _mm_mul_ps(va, acc[i][0])));
+    _mm_storeu_ps(row + 4, _mm_add_ps(_mm_loadu_ps(row + 4),
+                                      _mm_mul_ps(va, acc[i][1])));
+  }
+}
+
+}  // namespace
+
+template <>
+const BasicKernelTable<float>* Sse2Kernels<float>() noexcept {
+  static const BasicKernelTable<float> table{
+      SimdLevel::kSse2, {4, 8, MicroKernelSse2},
+      AddSse2,          SubSse2,
+      ScaleSse2,        AxpySse2,
+      TransposeSse2};
+  return &table;
+}
+
+template <>
+const BasicKernelTable<double>* Sse2Kernels<double>() noexcept {
+  static const KernelTable table{
+      SimdLevel::kSse2, {4, 4, MicroKernelSse2},
+      AddSse2,          SubSse2,
+      ScaleSse2,        AxpySse2,
+      TransposeSse2};
+  return &table;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#else  // S21_KERNELS_X86
+
+namespace S21 {
+namespace internal {
+
+template <>
+const BasicKernelTable<float>* Sse2Kernels<float>() noexcept {
+  return nullptr;
+}
+
+template <>
+const BasicKernelTable<double>* Sse2Kernels<double>() noexcept {
+  return nullptr;
+}
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // S21_KERNELS_X86
@@ -0,0 +1,395 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_lu.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Methods of the reusable LU factorization of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_lu.h"
+
+#include <algorithm>  // std::max | std::min
+#include <cmath>      // std::abs | std::isfinite | std::sqrt
+#include <limits>     // std::numeric_limits
+#include <mutex>      // std::once_flag | std::call_once
+
+#include "s21_gemm.h"
+#include "s21_kernels.h"
+
+namespace S21 {
+
+namespace {
+
+/**
+ * Dot product with four independent sums, so that the additions overlap
+ * instead of waiting on each other.
+ */
+template <class T>
+T Dot(int n, const T* a, const T* b) noexcept {
+  T sum[4] = {};
+  int k = 0;
+  for (; k + 4 <= n; k += 4) {
+    sum[0] += a[k] * b[k];
+    sum[1] += a[k + 1] * b[k + 1];
+    sum[2] += a[k + 2] * b[k + 2];
+    sum[3] += a[k + 3] * b[k + 3];
+  }
+  for (; k < n; ++k) {
+    sum[0] += a[k] * b[k];
+  }
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+}  // namespace
+
+/******************************************************************************
+ * CONSTRUCTOR
+ ******************************************************************************/
+
+/**
+ * Factorizes the matrix.
+ *
+ * @param matrix square matrix to factorize
+ *
+ * @throws std::invalid_argument if the matrix is not square
+ */
+template <class T>
+BasicLU<T>::BasicLU(const BasicMatrix<T>& matrix)
+    : lu_(matrix, matrix.resource_), det_(0) {
+  if (lu_.rows_ != lu_.cols_) {
+    throw std::invalid_argument("Incorrect matrix dimensions for LU");
+  }
+  pivots_.resize(lu_.rows_);
+  det_ = lu_.DecomposeLU(pivots_.data());
+}
+
+/******************************************************************************
+ * MAIN METHODS
+ ******************************************************************************/
+
+template <class T>
+int BasicLU<T>::GetSize() const noexcept { return lu_.rows_; }
+
+/**
+ * Checks for a pivot below n * epsilon of the largest one, the test
+ * S21Matrix::InverseMatrix uses as well.
+ */
+template <class T>
+bool BasicLU<T>::IsSingular() const noexcept { return HasTinyPivot(lu_); }
+
+template <class T>
+T BasicLU<T>::Determinant() const noexcept { return det_; }
+
+/**
+ * Solves A * x = b.
+ *
+ * @param b right-hand side of GetSize() elements
+ *
+ * @return the solution x
+ *
+ * @throws std::invalid_argument if the size of b is wrong or A is singular
+ */
+template <class T>
+std::vector<T> BasicLU<T>::Solve(const std::vector<T>& b) const {
+  const int n = lu_.rows_;
+  if (static_cast<int>(b.size()) != n) {
+    throw std::invalid_argument("Incorrect vector size for Solve");
+  }
+  CheckNonSingular();
+
+  std::vector<T> x(b);
+  for (int k = 0; k < n; ++k) {
+    std::swap(x[k], x[pivots_[k]]);
+  }
+  for (int i = 1; i < n; ++i) {
+    x[i] -= Dot(i, lu_.Row(i), x.data());
+  }
+  for (int i = n - 1; i >= 0; --i) {
+    const T* row = lu_.Row(i);
+    x[i] = (x[i] - Dot(n - i - 1, row + i + 1, x.data() + i + 1)) / row[i];
+  }
+  return x;
+}
+
+/**
+ * Solves A * X = B for every column of B at once.
+ *
+ * @param b right-hand sides, GetSize() rows
+ *
+ * @return the solutions X
+ *
+ * @throws std::invalid_argument if B has the wrong row count or A is singular
+ */
+template <class T>
+BasicMatrix<T> BasicLU<T>::Solve(const BasicMatrix<T>& b) const {
+  const int n = lu_.rows_;
+  if (b.rows_ != n) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Solve");
+  }
+  CheckNonSingular();
+
+  BasicMatrix<T> x{b, b.resource_};
+  const int m = x.cols_;
+  const auto axpy = internal::Kernels<T>().axpy;
+  for (int k = 0; k < n; ++k) {
+    if (pivots_[k] != k) {
+      std::swap_ranges(x.Row(k), x.Row(k) + m, x.Row(pivots_[k]));
+    }
+  }
+  for (int i = 1; i < n; ++i) {
+    const T* row = lu_.Row(i);
+    for (int k = 0; k < i; ++k) {
+      axpy(m, -row[k], x.Row(k), x.Row(i));
+    }
+  }
+  for (int i = n - 1; i >= 0; --i) {
+    const T* row = lu_.Row(i);
+    for (int k = i + 1; k < n; ++k) {
+      axpy(m, -row[k], x.Row(k), x.Row(i));
+    }
+    internal::Kernels<T>().scale(m, T(1) / row[i], x.Row(i));
+  }
+  return x;
+}
+
+/**
+ * Calculates A^-1 from the factors.
+ *
+ * @throws std::invalid_argument if A is singular
+ */
+template <class T>
+BasicMatrix<T> BasicLU<T>::Inverse() const {
+  CheckNonSingular();
+  BasicMatrix<T> result{lu_, lu_.resource_};
+  std::vector<T> work(lu_.rows_);
+  result.InvertLU(pivots_.data(), work.data());
+  return result;
+}
+
+/******************************************************************************
+ * PRIVATE METHODS
+ ******************************************************************************/
+
+/**
+ * Checks the diagonal of LU factors for a pivot below n * epsilon of the
+ * largest one, in which case the factorized matrix is numerically singular.
+ *
+ * @details Relative, so that 0.01 * I is as invertible as I in float, whose
+ * determinant 1e-8 of the 4x4 case would fail any absolute test.
+ */
+template <class T>
+bool BasicLU<T>::HasTinyPivot(const BasicMatrix<T>& factors) noexcept {
+  using Real = typename BasicMatrix<T>::Real;
+  Real min_pivot = std::numeric_limits<Real>::max();
+  Real max_pivot = 0;
+  for (int k = 0; k < factors.rows_; ++k) {
+    const Real pivot = std::abs(factors.Row(k)[k]);
+    min_pivot = std::min(min_pivot, pivot);
+    max_pivot = std::max(max_pivot, pivot);
+  }
+  return min_pivot <= factors.rows_ * BasicMatrix<T>::kMinEps * max_pivot;
+}
+
+template <class T>
+void BasicLU<T>::CheckNonSingular() const {
+  if (IsSingular()) {
+    throw std::invalid_argument("Matrix is singular");
+  }
+}
+
+template class BasicLU<float>;
+template class BasicLU<double>;
+template class BasicLU<long double>;
+template class BasicLU<std::complex<float>>;
+template class BasicLU<std::complex<double>>;
+
+/******************************************************************************
+ * MIXED PRECISION
+ ******************************************************************************/
+
+namespace {
+
+enum class Refinement { kConverged, kContinue, kFailed };
+
+/**
+ * Max-norm of n elements stride apart; NaN if any of them is NaN.
+ */
+double MaxAbs(int n, const double* x, std::ptrdiff_t stride) {
+  double norm = 0.0;
+  for (int i = 0; i < n; ++i) {
+    const double value = std::abs(x[i * stride]);
+    if (!(value <= norm)) norm = value;
+  }
+  return norm;
+}
+
+/**
+ * Applies the stopping test of dsgesv to every column of the n x m
+ * residual r and solution x.
+ */
+Refinement CheckResidual(int n, int m, const double* r, std::ptrdiff_t ldr,
+                         const double* x, std::ptrdiff_t ldx,
+                         double tolerance) {
+  Refinement state = Refinement::kConverged;
+  for (int j = 0; j < m; ++j) {
+    const double r_norm = MaxAbs(n, r + j, ldr);
+    const double x_norm = MaxAbs(n, x + j, ldx);
+    if (!std::isfinite(r_norm) || !std::isfinite(x_norm)) {
+      return Refinement::kFailed;
+    }
+    if (r_norm > x_norm * tolerance) state = Refinement::kContinue;
+  }
+  return state;
+}
+
+}  // namespace
+
+struct S21MixedLU::LazyLU {
+  std::once_flag once;
+  std::optional<S21LU> lu;
+};
+
+/**
+ * Factorizes a float copy of the matrix.
+ *
+ * @param matrix square matrix to factorize
+ *
+ * @throws std::invalid_argument if the matrix is not square
+ */
+S21MixedLU::S21MixedLU(const S21Matrix& matrix)
+    : matrix_(matrix), tolerance_(0), fallback_(std::make_shared<LazyLU>()) {
+  const int n = matrix_.GetRows();
+  if (n != matrix_.GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for LU");
+  }
+  double norm = 0.0, max_element = 0.0;
+  for (int i = 0; i < n; ++i) {
+    const double* row = matrix_.RowPtr(i);
+    double sum = 0.0;
+    for (int j = 0; j < n; ++j) {
+      sum += std::abs(row[j]);
+      max_element = std::max(max_element, std::abs(row[j]));
+    }
+    norm = std::max(norm, sum);
+  }
+  tolerance_ = norm * std::sqrt(static_cast<double>(n)) *
+               std::numeric_limits<double>::epsilon() / 2;
+  if (max_element <= std::numeric_limits<float>::max()) {
+    single_.emplace(BasicMatrix<float>(matrix_));
+    if (single_->IsSingular()) single_.reset();
+  }
+}
+
+int S21MixedLU::GetSize() const noexcept { return matrix_.GetRows(); }
+
+/**
+ * Tells whether Solve starts from float factors; false when A overflows
+ * float or loses its last pivot in it, and every Solve uses S21LU.
+ */
+bool S21MixedLU::IsSinglePrecision() const noexcept {
+  return single_.has_value();
+}
+
+/**
+ * Solves A * x = b to double accuracy.
+ *
+ * @param b right-hand side of GetSize() elements
+ * @param info where to report the refinement, may be nullptr
+ *
+ * @return the solution x
+ *
+ * @throws std::invalid_argument if the size of b is wrong or A is singular
+ */
+std::vector<double> S21MixedLU::Solve(const std::vector<double>& b,
+                                      S21RefinementInfo* info) const {
+  const int n = GetSize();
+  if (static_cast<int>(b.size()) != n) {
+    throw std::invalid_argument("Incorrect vector size for Solve");
+  }
+  S21RefinementInfo result;
+  std::vector<double> x;
+  if (single_) {
+    std::vector<double> r(b);
+    x.assign(n, 0.0);
+    for (;;) {
+      const std::vector<float> d =
+          single_->Solve(std::vector<float>(r.begin(), r.end()));
+      for (int i = 0; i < n; ++i) {
+        x[i] += d[i];
+      }
+      for (int i = 0; i < n; ++i) {
+        r[i] = b[i] - Dot(n, matrix_.RowPtr(i), x.data());
+      }
+      const Refinement state =
+          CheckResidual(n, 1, r.data(), 1, x.data(), 1, tolerance_);
+      result.converged = state == Refinement::kConverged;
+      if (result.converged || state == Refinement::kFailed ||
+          result.iterations == kMaxRefinements) {
+        break;
+      }
+      ++result.iterations;
+    }
+  }
+  if (info) *info = result;
+  if (result.converged) return x;
+  return Fallback().Solve(b);
+}
+
+/**
+ * Solves A * X = B to double accuracy for every column of B at once; the
+ * residuals come from one GEMM per step.
+ *
+ * @param b right-hand sides, GetSize() rows
+ * @param info where to report the refinement, may be nullptr
+ *
+ * @return the solutions X
+ *
+ * @throws std::invalid_argument if B has the wrong row count or A is singular
+ */
+S21Matrix S21MixedLU::Solve(const S21Matrix& b, S21RefinementInfo* info) const {
+  const int n = GetSize();
+  if (b.GetRows() != n) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Solve");
+  }
+  const int m = b.GetCols();
+  S21RefinementInfo result;
+  S21Matrix x(n, m);
+  if (single_) {
+    S21Matrix r(b);
+    for (;;) {
+      x += S21Matrix(single_->Solve(BasicMatrix<float>(r)));
+      r = b;
+      internal::Gemm(n, m, n, -1.0, matrix_.data(), matrix_.GetStride(),
+                     x.data(), x.GetStride(), r.data(), r.GetStride());
+      const Refinement state =
+          CheckResidual(n, m, r.data(), r.GetStride(), x.data(),
+                        x.GetStride(), tolerance_);
+      result.converged = state == Refinement::kConverged;
+      if (result.converged || state == Refinement::kFailed ||
+          result.iterations == kMaxRefinements) {
+        break;
+      }
+      ++result.iterations;
+    }
+  }
+  if (info) *info = result;
+  if (result.converged) return x;
+  return Fallback().Solve(b);
+}
+
+/**
+ * Returns the double-precision factors, computing them on first use.
+ */
+const S21LU& S21MixedLU::Fallback() const {
+  std::call_once(fallback_->once, [this] { fallback_->lu.emplace(matrix_); });
+  return *fallback_->lu;
+}
+
+}  // namespace S21
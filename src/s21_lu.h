@@ -0,0 +1,113 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_lu.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the reusable LU factorization of the
+ * CPP1_s21_matrixplus project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_LU_H_
+#define CPP1_S21_MATRIXPLUS_S21_LU_H_
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace S21 {
+
+/**
+ * P * A = L * U factorization of a square matrix with partial pivoting.
+ *
+ * Factorizing costs O(n^3) once; every following Solve costs O(n^2) per
+ * right-hand side. T is float, double, long double, std::complex<float> or
+ * std::complex<double>; complex pivots are chosen by magnitude.
+ */
+template <class T>
+class BasicLU {
+ public:
+  explicit BasicLU(const BasicMatrix<T>& matrix);
+
+  int GetSize() const noexcept;
+  bool IsSingular() const noexcept;
+  T Determinant() const noexcept;
+  std::vector<T> Solve(const std::vector<T>& b) const;
+  BasicMatrix<T> Solve(const BasicMatrix<T>& b) const;
+  BasicMatrix<T> Inverse() const;
+
+ private:
+  friend class BasicMatrix<T>;
+
+  static bool HasTinyPivot(const BasicMatrix<T>& factors) noexcept;
+  void CheckNonSingular() const;
+
+  // L below the diagonal (unit diagonal implied), U on and above
+  BasicMatrix<T> lu_;
+  std::vector<int> pivots_;
+  T det_;
+};
+
+using S21LU = BasicLU<double>;
+using S21ComplexLU = BasicLU<std::complex<double>>;
+
+/**
+ * How S21MixedLU::Solve reached its result.
+ */
+struct S21RefinementInfo {
+  int iterations = 0;      // refinement steps after the first solve
+  bool converged = false;  // false: solved by the double-precision fallback
+};
+
+/**
+ * Double-precision solver that factorizes in float and refines in double.
+ *
+ * Every Solve starts from the float factors and corrects the
+ * solution with residuals b - A * x computed in double against the original
+ * matrix, stopping once |r|_inf <= |x|_inf * |A|_inf * sqrt(n) * u as LAPACK
+ * dsgesv does. While cond(A) stays well below 1 / FLT_EPSILON this reaches
+ * the accuracy of S21LU after a few O(n^2) steps, and the O(n^3)
+ * factorization reads half the bytes. When refinement does not converge
+ * within kMaxRefinements steps, or A does not fit in float, Solve falls
+ * back to an S21LU of A, factorized on first use and shared by copies.
+ */
+class S21MixedLU {
+ public:
+  static constexpr int kMaxRefinements = 30;
+
+  explicit S21MixedLU(const S21Matrix& matrix);
+
+  int GetSize() const noexcept;
+  bool IsSinglePrecision() const noexcept;
+  std::vector<double> Solve(const std::vector<double>& b,
+                            S21RefinementInfo* info = nullptr) const;
+  S21Matrix Solve(const S21Matrix& b, S21RefinementInfo* info = nullptr) const;
+
+ private:
+  struct LazyLU;
+
+  const S21LU& Fallback() const;
+
+  S21Matrix matrix_;
+  double tolerance_;
+  // Empty when A overflows float or its float factors are singular
+  std::optional<BasicLU<float>> single_;
+  std::shared_ptr<LazyLU> fallback_;
+};
+
+extern template class BasicLU<float>;
+extern template class BasicLU<double>;
+extern template class BasicLU<long double>;
+extern template class BasicLU<std::complex<float>>;
+extern template class BasicLU<std::complex<double>>;
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_LU_H_
@@ -0,0 +1,474 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_matrix_expr.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the lazy element-wise expressions of the
+ * CPP1_s21_matrixplus project.
+ *
+ * @details A + B - C * 2.0 builds a tree of lightweight nodes instead of
+ * three temporary matrices. The tree is evaluated in a single pass when it
+ * is assigned to (or used to construct) an S21Matrix, writing straight into
+ * the destination. Dimensions are checked while the tree is built, so
+ * mismatches throw at the operator as before. Matrix products are not
+ * element-wise and are computed eagerly, materializing an expression operand
+ * first.
+ *
+ * Operands that are named matrices are referenced, temporaries are moved into
+ * the tree. Keep expressions in S21Matrix variables, or call Eval() when
+ * declaring them auto: a tree must not outlive the named matrices it refers
+ * to. A new matrix built from a tree holding a temporary takes over that
+ * temporary's buffer, so (A * B) + C allocates only for the product. Both
+ * operands of a node have the same element type, its value_type; mixing types
+ * takes an explicit conversion.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_MATRIX_EXPR_H_
+#define CPP1_S21_MATRIXPLUS_S21_MATRIX_EXPR_H_
+
+#include <stdexcept>    // out_of_range | invalid_argument
+#include <type_traits>  // std::enable_if_t | std::is_base_of_v
+#include <utility>      // std::forward | std::move
+
+#include "s21_matrix_oop.h"
+
+namespace S21 {
+
+/**
+ * Base of every lazy matrix expression, E is the concrete node.
+ *
+ * @details A node reports its size with GetRows()/GetCols(), computes one
+ * element with At(i, j) and offers the buffer of a temporary it owns, if
+ * any, with Reusable().
+ */
+template <class E>
+struct MatrixExpr {
+  const E& Self() const noexcept { return static_cast<const E&>(*this); }
+  E& Self() noexcept { return static_cast<E&>(*this); }
+
+  // The matrix the expression evaluates to, for auto variables
+  auto Eval() const& { return Matrix(*this); }
+  auto Eval() && { return Matrix(static_cast<MatrixExpr&&>(*this)); }
+
+  // The rest of the S21Matrix interface, on the evaluated expression. E is
+  // incomplete here, hence the deduced return types.
+  auto Transpose() const& { return Matrix(*this).Transpose(); }
+  auto Transpose() && {
+    return Matrix(static_cast<MatrixExpr&&>(*this)).Transpose();
+  }
+  auto Determinant() const { return Matrix(*this).Determinant(); }
+  auto CalcComplements() const { return Matrix(*this).CalcComplements(); }
+  auto InverseMatrix() const { return Matrix(*this).InverseMatrix(); }
+  template <class Other>
+  bool EqMatrix(const Other& other) const {
+    return Matrix(*this).EqMatrix(other);
+  }
+  // An expression has no storage to change: the main methods return the
+  // evaluated matrix they changed
+  template <class Other>
+  auto SumMatrix(const Other& other) const {
+    auto result = Matrix(*this);
+    result.SumMatrix(other);
+    return result;
+  }
+  template <class Other>
+  auto SubMatrix(const Other& other) const {
+    auto result = Matrix(*this);
+    result.SubMatrix(other);
+    return result;
+  }
+  template <class Num>
+  auto MulNumber(const Num num) const {
+    auto result = Matrix(*this);
+    result.MulNumber(num);
+    return result;
+  }
+  template <class Other>
+  auto MulMatrix(const Other& other) const {
+    auto result = Matrix(*this);
+    result.MulMatrix(other);
+    return result;
+  }
+  auto operator()(int i, int j) const {
+    if (i < 0 || j < 0 || i >= Self().GetRows() || j >= Self().GetCols()) {
+      throw std::out_of_range("Index outside the matrix");
+    }
+    return Self().At(i, j);
+  }
+
+ private:
+  template <class Expr>
+  static auto Matrix(Expr&& expr) {
+    return BasicMatrix<typename E::value_type>(std::forward<Expr>(expr));
+  }
+};
+
+namespace internal {
+
+/**
+ * Leaf referring to a matrix that outlives the expression.
+ */
+template <class T>
+class MatrixRef : public MatrixExpr<MatrixRef<T>> {
+ public:
+  using value_type = T;
+
+  explicit MatrixRef(const BasicMatrix<T>& matrix) noexcept
+      : matrix_(&matrix) {}
+
+  int GetRows() const noexcept { return matrix_->rows_; }
+  int GetCols() const noexcept { return matrix_->cols_; }
+  T At(int i, int j) const noexcept { return matrix_->Row(i)[j]; }
+  BasicMatrix<T>* Reusable() noexcept { return nullptr; }
+
+ private:
+  const BasicMatrix<T>* matrix_;
+};
+
+/**
+ * Leaf owning a temporary matrix, such as a materialized product.
+ */
+template <class T>
+class MatrixValue : public MatrixExpr<MatrixValue<T>> {
+ public:
+  using value_type = T;
+
+  explicit MatrixValue(BasicMatrix<T>&& matrix) noexcept
+      : matrix_(std::move(matrix)) {}
+
+  int GetRows() const noexcept { return matrix_.rows_; }
+  int GetCols() const noexcept { return matrix_.cols_; }
+  T At(int i, int j) const noexcept { return matrix_.Row(i)[j]; }
+  BasicMatrix<T>* Reusable() noexcept { return &matrix_; }
+
+ private:
+  BasicMatrix<T> matrix_;
+};
+
+struct Plus {
+  static constexpr const char* kError = "Incorrect matrix dimensions for Sum";
+  template <class T>
+  static T Apply(T a, T b) noexcept {
+    return a + b;
+  }
+};
+
+struct Minus {
+  static constexpr const char* kError = "Incorrect matrix dimensions for Sub";
+  template <class T>
+  static T Apply(T a, T b) noexcept {
+    return a - b;
+  }
+};
+
+/**
+ * Element-wise combination of two expressions of the same size.
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+template <class L, class R, class Op>
+class BinaryExpr : public MatrixExpr<BinaryExpr<L, R, Op>> {
+ public:
+  using value_type = typename L::value_type;
+
+  BinaryExpr(L lhs, R rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {
+    if (lhs_.GetRows() != rhs_.GetRows() ||
+        lhs_.GetCols() != rhs_.GetCols()) {
+      throw std::invalid_argument(Op::kError);
+    }
+  }
+
+  int GetRows() const noexcept { return lhs_.GetRows(); }
+  int GetCols() const noexcept { return lhs_.GetCols(); }
+  value_type At(int i, int j) const noexcept {
+    return Op::Apply(lhs_.At(i, j), rhs_.At(i, j));
+  }
+  BasicMatrix<value_type>* Reusable() noexcept {
+    BasicMatrix<value_type>* buffer = lhs_.Reusable();
+    return buffer ? buffer : rhs_.Reusable();
+  }
+
+ private:
+  L lhs_;
+  R rhs_;
+};
+
+/**
+ * Expression multiplied by a number.
+ */
+template <class E>
+class ScaledExpr : public MatrixExpr<ScaledExpr<E>> {
+ public:
+  using value_type = typename E::value_type;
+
+  ScaledExpr(E expr, value_type num) noexcept
+      : expr_(std::move(expr)), num_(num) {}
+
+  int GetRows() const noexcept { return expr_.GetRows(); }
+  int GetCols() const noexcept { return expr_.GetCols(); }
+  value_type At(int i, int j) const noexcept {
+    return expr_.At(i, j) * num_;
+  }
+  BasicMatrix<value_type>* Reusable() noexcept { return expr_.Reusable(); }
+
+ private:
+  E expr_;
+  value_type num_;
+};
+
+template <class T>
+MatrixRef<T> MakeNode(const BasicMatrix<T>& matrix) noexcept {
+  return MatrixRef<T>(matrix);
+}
+template <class T>
+MatrixValue<T> MakeNode(BasicMatrix<T>&& matrix) noexcept {
+  return MatrixValue<T>(std::move(matrix));
+}
+template <class E>
+E MakeNode(const MatrixExpr<E>& expr) {
+  return expr.Self();
+}
+template <class E>
+E MakeNode(MatrixExpr<E>&& expr) {
+  return std::move(static_cast<E&>(expr));
+}
+
+template <class T>
+using Decay = std::remove_cv_t<std::remove_reference_t<T>>;
+template <class T>
+struct IsMatrix : std::false_type {};
+template <class T>
+struct IsMatrix<BasicMatrix<T>> : std::true_type {};
+template <class T>
+constexpr bool kIsExpr = std::is_base_of_v<MatrixExpr<Decay<T>>, Decay<T>>;
+template <class T>
+constexpr bool kIsOperand = kIsExpr<T> || IsMatrix<Decay<T>>::value;
+template <class T>
+using Node = decltype(MakeNode(std::declval<T>()));
+// Element type of an operand, only named once kIsOperand holds
+template <class T>
+using ValueType = typename Decay<T>::value_type;
+
+// Two operands of the same element type
+template <class L, class R, bool = kIsOperand<L> && kIsOperand<R>>
+constexpr bool kArePeers = false;
+template <class L, class R>
+constexpr bool kArePeers<L, R, true> =
+    std::is_same_v<ValueType<L>, ValueType<R>>;
+
+template <class T>
+const BasicMatrix<T>& Materialize(const BasicMatrix<T>& matrix) noexcept {
+  return matrix;
+}
+template <class E>
+BasicMatrix<typename E::value_type> Materialize(const MatrixExpr<E>& expr) {
+  return BasicMatrix<typename E::value_type>(expr);
+}
+
+}  // namespace internal
+
+/******************************************************************************
+ * OPERATORS
+ ******************************************************************************/
+
+/**
+ * Lazy element-wise sum of matrices and expressions.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sum
+ */
+template <class L, class R,
+          class = std::enable_if_t<internal::kArePeers<L, R>>>
+internal::BinaryExpr<internal::Node<L>, internal::Node<R>, internal::Plus>
+operator+(L&& lhs, R&& rhs) {
+  return {internal::MakeNode(std::forward<L>(lhs)),
+          internal::MakeNode(std::forward<R>(rhs))};
+}
+
+/**
+ * Lazy element-wise difference of matrices and expressions.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sub
+ */
+template <class L, class R,
+          class = std::enable_if_t<internal::kArePeers<L, R>>>
+internal::BinaryExpr<internal::Node<L>, internal::Node<R>, internal::Minus>
+operator-(L&& lhs, R&& rhs) {
+  return {internal::MakeNode(std::forward<L>(lhs)),
+          internal::MakeNode(std::forward<R>(rhs))};
+}
+
+/**
+ * Lazy product of a matrix or an expression and a number.
+ */
+template <class E, class = std::enable_if_t<internal::kIsOperand<E>>>
+internal::ScaledExpr<internal::Node<E>> operator*(
+    E&& expr, internal::ValueType<E> num) {
+  return {internal::MakeNode(std::forward<E>(expr)), num};
+}
+
+template <class E, class = std::enable_if_t<internal::kIsOperand<E>>>
+internal::ScaledExpr<internal::Node<E>> operator*(
+    internal::ValueType<E> num, E&& expr) {
+  return {internal::MakeNode(std::forward<E>(expr)), num};
+}
+
+/**
+ * Matrix product with at least one expression operand, which is evaluated
+ * first.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for
+ * Multiplication
+ */
+template <class L, class R,
+          class = std::enable_if_t<
+              internal::kArePeers<L, R> &&
+              (internal::kIsExpr<L> || internal::kIsExpr<R>)>>
+BasicMatrix<internal::ValueType<L>> operator*(const L& lhs, const R& rhs) {
+  return internal::Materialize(lhs) * internal::Materialize(rhs);
+}
+
+/**
+ * Element-wise comparison with an expression on the left, which is evaluated
+ * first.
+ */
+template <class L, class R,
+          class = std::enable_if_t<internal::kArePeers<L, R> &&
+                                   internal::kIsExpr<L>>>
+bool operator==(const L& lhs, const R& rhs) {
+  return lhs.EqMatrix(rhs);
+}
+
+/**
+ * Element-wise comparison of a matrix and an expression, which is evaluated
+ * first. The forwarding reference makes it a better match than the member
+ * operator== of a non-const matrix.
+ */
+template <class L, class R,
+          class = std::enable_if_t<internal::kArePeers<L, R> &&
+                                   !internal::kIsExpr<L> &&
+                                   internal::kIsExpr<R>>,
+          class = void>
+bool operator==(L&& lhs, const R& rhs) {
+  return rhs.EqMatrix(lhs);
+}
+
+/******************************************************************************
+ * BasicMatrix MEMBERS
+ ******************************************************************************/
+
+/**
+ * Evaluates an expression into a new matrix in one pass.
+ */
+template <class T>
+template <class E>
+BasicMatrix<T>::BasicMatrix(const MatrixExpr<E>& expr)
+    : BasicMatrix(expr, nullptr) {}
+
+/**
+ * Evaluates an expression into a new matrix with a buffer from resource.
+ */
+template <class T>
+template <class E>
+BasicMatrix<T>::BasicMatrix(const MatrixExpr<E>& expr,
+                            std::pmr::memory_resource* resource)
+    : rows_(expr.Self().GetRows()),
+      cols_(expr.Self().GetCols()),
+      stride_(cols_),
+      row_capacity_(rows_),
+      resource_(resource),
+      matrix_(nullptr) {
+  AllocateStorage();
+  Evaluate(expr.Self(), [](T& dst, T value) { dst = value; });
+}
+
+/**
+ * Evaluates an expiring expression, in the buffer of a temporary it owns
+ * when there is one.
+ *
+ * @details Every element is read only to produce itself, so the temporary
+ * can be overwritten while the expression reads it.
+ */
+template <class T>
+template <class E>
+BasicMatrix<T>::BasicMatrix(MatrixExpr<E>&& expr) : BasicMatrix(nullptr) {
+  if (BasicMatrix* buffer = expr.Self().Reusable()) {
+    buffer->Evaluate(expr.Self(), [](T& dst, T value) { dst = value; });
+    StealMatrix(*buffer);
+  } else {
+    *this = BasicMatrix(static_cast<const MatrixExpr<E>&>(expr));
+  }
+}
+
+/**
+ * Evaluates an expression into this matrix.
+ *
+ * @details Reuses the buffer when the size matches, otherwise allocates from
+ * the resource of this matrix. The expression may refer to this matrix:
+ * every element is read only to produce itself.
+ */
+template <class T>
+template <class E>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const MatrixExpr<E>& expr) {
+  if (rows_ != expr.Self().GetRows() || cols_ != expr.Self().GetCols()) {
+    *this = BasicMatrix(expr, resource_);
+  } else {
+    Evaluate(expr.Self(), [](T& dst, T value) { dst = value; });
+  }
+  return *this;
+}
+
+template <class T>
+template <class E>
+BasicMatrix<T>& BasicMatrix<T>::operator=(MatrixExpr<E>&& expr) {
+  const BasicMatrix* buffer = expr.Self().Reusable();
+  if ((rows_ != expr.Self().GetRows() || cols_ != expr.Self().GetCols()) &&
+      buffer && buffer->resource_ == resource_) {
+    *this = BasicMatrix(std::move(expr));
+  } else {
+    *this = static_cast<const MatrixExpr<E>&>(expr);
+  }
+  return *this;
+}
+
+template <class T>
+template <class E>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const MatrixExpr<E>& expr) {
+  if (rows_ != expr.Self().GetRows() || cols_ != expr.Self().GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sum");
+  }
+  Evaluate(expr.Self(), [](T& dst, T value) { dst += value; });
+  return *this;
+}
+
+template <class T>
+template <class E>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const MatrixExpr<E>& expr) {
+  if (rows_ != expr.Self().GetRows() || cols_ != expr.Self().GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sub");
+  }
+  Evaluate(expr.Self(), [](T& dst, T value) { dst -= value; });
+  return *this;
+}
+
+template <class T>
+template <class E, class Store>
+void BasicMatrix<T>::Evaluate(const E& expr, Store store) noexcept {
+  static_assert(std::is_same_v<typename E::value_type, T>,
+                "Convert the matrix to the element type of the expression");
+  for (int i = 0; i < rows_; ++i) {
+    T* row = Row(i);
+    for (int j = 0; j < cols_; ++j) {
+      store(row[j], expr.At(i, j));
+    }
+  }
+}
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_MATRIX_EXPR_H_
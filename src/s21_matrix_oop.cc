@@ -15,6 +15,12 @@
 
 #include "s21_matrix_oop.h"
 
+#include "s21_buffer_pool.h"
+#include "s21_gemm.h"
+#include "s21_kernels.h"
+#include "s21_lu.h"
+#include "s21_transpose.h"
+
 namespace S21 {
 
 /******************************************************************************
@@ -30,7 +36,8 @@ namespace S21 {
  *
  * @throws None
  */
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+template <class T>
+BasicMatrix<T>::BasicMatrix() : BasicMatrix(nullptr) {}
 
 /**
  * Constructor for S21Matrix class.
@@ -40,28 +47,46 @@ S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
  *
  * @throws std::invalid_argument if rows or cols are less than zero
  */
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
-  if (rows_ < 0 || cols_ < 0) {
-    throw std::invalid_argument(
-        "Matrix size must be great then or equal to zero");
-  }
-  AllocateMatrix();
-}
+template <class T>
+BasicMatrix<T>::BasicMatrix(int rows, int cols)
+    : BasicMatrix(rows, cols, nullptr) {}
 
 /**
  * Constructor for creating a copy of the S21Matrix object.
  *
+ * @details One allocation and one memcpy when the source rows are packed.
+ *
  * @param other The S21Matrix object to be copied
  *
  * @return None
  *
  * @throws None
  */
-S21Matrix::S21Matrix(const S21Matrix& other)
-    : S21Matrix(other.rows_, other.cols_) {
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] = other.matrix_[i][j];
+template <class T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& other)
+    : BasicMatrix(other, nullptr) {}
+
+/**
+ * Constructor copying other into a buffer from the given resource.
+ *
+ * @details One allocation and one memcpy when the source rows are packed.
+ *
+ * @param other The S21Matrix object to be copied
+ * @param resource where the buffer comes from, nullptr for operator new
+ *
+ * @throws std::bad_alloc if the resource cannot allocate the buffer
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& other,
+                     std::pmr::memory_resource* resource)
+    : BasicMatrix(other.rows_, other.cols_, resource) {
+  if (!matrix_) return;
+  if (other.stride_ == cols_) {
+    std::memcpy(matrix_, other.matrix_,
+                sizeof(T) * static_cast<std::size_t>(rows_) * cols_);
+  } else {
+    for (int i = 0; i < rows_; ++i) {
+      std::memcpy(Row(i), other.Row(i), sizeof(T) * cols_);
     }
   }
 }
@@ -69,30 +94,38 @@ S21Matrix::S21Matrix(const S21Matrix& other)
 /**
  * Constructor for moving S21Matrix object.
  *
+ * @details A heap buffer changes owner in O(1); a small matrix copies its
+ * at most kInlineSize inline elements.
+ *
  * @param other S21Matrix object to be moved
  *
  * @return N/A
  *
  * @throws N/A
  */
-S21Matrix::S21Matrix(S21Matrix&& other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
-  other.rows_ = 0;
-  other.cols_ = 0;
-  other.matrix_ = nullptr;
+template <class T>
+BasicMatrix<T>::BasicMatrix(BasicMatrix&& other) noexcept
+    : BasicMatrix(nullptr) {
+  StealMatrix(other);
 }
 
-S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
-  std::swap(rows_, other.rows_);
-  std::swap(cols_, other.cols_);
-  std::swap(matrix_, other.matrix_);
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(BasicMatrix&& other) noexcept {
+  if (this != &other) {
+    DeallocateMatrix();
+    StealMatrix(other);
+  }
 
   return *this;
 }
 
-S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
+/**
+ * Copies other into a buffer from the resource of this matrix.
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const BasicMatrix& other) {
   if (this != &other) {
-    S21Matrix copy(other);
+    BasicMatrix copy(other, resource_);
     *this = std::move(copy);
   }
   return *this;
@@ -110,9 +143,15 @@ S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
  *
  * @throws std::invalid_argument if rows or cols are not greater than zero
  */
-S21Matrix::S21Matrix(
-    std::initializer_list<std::initializer_list<double>> initList)
-    : rows_(initList.size()), cols_(initList.begin()->size()) {
+template <class T>
+BasicMatrix<T>::BasicMatrix(
+    std::initializer_list<std::initializer_list<T>> initList)
+    : rows_(initList.size()),
+      cols_(initList.begin()->size()),
+      stride_(cols_),
+      row_capacity_(rows_),
+      resource_(nullptr),
+      matrix_(nullptr) {
   if (!rows_ || !cols_) {
     throw std::invalid_argument("Rows and Cols must be greater than zero");
   }
@@ -121,24 +160,78 @@ S21Matrix::S21Matrix(
 
   int rowIndex = 0;
   for (const auto& row : initList) {
-    int colIndex = 0;
-    for (const auto& value : row) {
-      matrix_[rowIndex][colIndex++] = value;
-    }
-    ++rowIndex;
+    std::copy_n(row.begin(), std::min<std::size_t>(row.size(), cols_),
+                Row(rowIndex++));
   }
 }
 
 /**
- * Destructor for S21Matrix class.
+ * Constructor copying the elements of a view.
+ *
+ * @param view the elements to copy, possibly a block or a transposed window
+ *
+ * @throws None
  */
-S21Matrix::~S21Matrix() noexcept {
-  for (int j = 0; j < rows_; ++j) {
-    delete[] matrix_[j];
+template <class T>
+BasicMatrix<T>::BasicMatrix(const ConstView& view)
+    : rows_(view.GetRows()),
+      cols_(view.GetCols()),
+      stride_(cols_),
+      row_capacity_(rows_),
+      resource_(nullptr),
+      matrix_(nullptr) {
+  AllocateStorage();
+  View().Assign(view);
+}
+
+/**
+ * Constructor of an empty matrix whose buffers will come from resource.
+ *
+ * @param resource where the buffer comes from, nullptr for operator new
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(std::pmr::memory_resource* resource) noexcept
+    : rows_(0),
+      cols_(0),
+      stride_(0),
+      row_capacity_(0),
+      resource_(resource),
+      matrix_(nullptr) {}
+
+/**
+ * Constructor of a zero rows x cols matrix in a buffer from resource.
+ *
+ * @details A monotonic arena suits request-scoped computations, a pool
+ * steady workloads; the resource must outlive the matrix.
+ *
+ * @param rows the number of rows in the matrix
+ * @param cols the number of columns in the matrix
+ * @param resource where the buffer comes from, nullptr for operator new
+ *
+ * @throws std::invalid_argument if rows or cols are less than zero
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(int rows, int cols,
+                            std::pmr::memory_resource* resource)
+    : rows_(rows),
+      cols_(cols),
+      stride_(cols),
+      row_capacity_(rows),
+      resource_(resource),
+      matrix_(nullptr) {
+  if (rows_ < 0 || cols_ < 0) {
+    throw std::invalid_argument(
+        "Matrix size must be great then or equal to zero");
   }
-  delete[] matrix_;
+  AllocateMatrix();
 }
 
+/**
+ * Destructor for S21Matrix class.
+ */
+template <class T>
+BasicMatrix<T>::~BasicMatrix() noexcept { DeallocateMatrix(); }
+
 /******************************************************************************
  * MAIN METHODS
  ******************************************************************************/
@@ -152,14 +245,17 @@ S21Matrix::~S21Matrix() noexcept {
  *
  * @throws None
  */
-bool S21Matrix::EqMatrix(const S21Matrix& other) noexcept {
+template <class T>
+bool BasicMatrix<T>::EqMatrix(const BasicMatrix& other) noexcept {
   if (rows_ != other.rows_ || cols_ != other.cols_) {
     return false;
   }
 
   for (int i = 0; i < rows_; ++i) {
+    const T* row = Row(i);
+    const T* other_row = other.Row(i);
     for (int j = 0; j < cols_; ++j) {
-      if (matrix_[i][j] != other.matrix_[i][j]) {
+      if (row[j] != other_row[j]) {
         return false;
       }
     }
@@ -175,16 +271,21 @@ bool S21Matrix::EqMatrix(const S21Matrix& other) noexcept {
  *
  * @throws std::invalid_argument Incorrect matrix dimensions for Sum
  */
-void S21Matrix::SumMatrix(const S21Matrix& other) {
-  if (rows_ != other.rows_ || cols_ != other.cols_) {
-    throw std::invalid_argument("Incorrect matrix dimensions for Sum");
-  }
+template <class T>
+void BasicMatrix<T>::SumMatrix(const BasicMatrix& other) {
+  SumMatrix(other.View());
+}
 
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] += other.matrix_[i][j];
-    }
-  }
+/**
+ * Adds the elements viewed by other, which may belong to this matrix.
+ *
+ * @param other The view to be added to the current matrix.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sum
+ */
+template <class T>
+void BasicMatrix<T>::SumMatrix(const ConstView& other) {
+  View().SumMatrix(other);
 }
 
 /**
@@ -195,16 +296,14 @@ void S21Matrix::SumMatrix(const S21Matrix& other) {
  * @throws std::invalid_argument if the dimensions of the given S21Matrix do not
  * match this matrix
  */
-void S21Matrix::SubMatrix(const S21Matrix& other) {
-  if (rows_ != other.rows_ || cols_ != other.cols_) {
-    throw std::invalid_argument("Incorrect matrix dimensions for Sub");
-  }
+template <class T>
+void BasicMatrix<T>::SubMatrix(const BasicMatrix& other) {
+  SubMatrix(other.View());
+}
 
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] -= other.matrix_[i][j];
-    }
-  }
+template <class T>
+void BasicMatrix<T>::SubMatrix(const ConstView& other) {
+  View().SubMatrix(other);
 }
 
 /**
@@ -216,53 +315,151 @@ void S21Matrix::SubMatrix(const S21Matrix& other) {
  *
  * @throws none
  */
-void S21Matrix::MulNumber(const double num) noexcept {
+template <class T>
+void BasicMatrix<T>::MulNumber(const T num) noexcept {
+  const auto scale = internal::Kernels<T>().scale;
+  if (stride_ == cols_) {
+    scale(static_cast<std::ptrdiff_t>(rows_) * cols_, num, matrix_);
+    return;
+  }
   for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      matrix_[i][j] *= num;
-    }
+    scale(cols_, num, Row(i));
   }
 }
 
 /**
  * Multiply this matrix by another matrix.
  *
+ * @details The product is computed by the blocked GEMM engine (s21_gemm.h),
+ * or by Strassen-Winograd recursion over it when the global policy asks for
+ * it (s21_strassen.h).
+ *
  * @param other The other matrix to multiply with
  *
  * @throws std::invalid_argument if the matrix dimensions are incorrect for
  * multiplication
  */
-void S21Matrix::MulMatrix(const S21Matrix& other) {
-  if (cols_ != other.rows_) {
-    throw std::invalid_argument(
-        "Incorrect matrix dimensions for Multiplication");
-  }
-  S21Matrix result{rows_, other.cols_};
+template <class T>
+void BasicMatrix<T>::MulMatrix(const BasicMatrix& other) {
+  // It is more optimal to use moving instead of copying
+  *this = *this * other;
+}
 
-  for (int i = 0; i < result.rows_; ++i) {
-    for (int j = 0; j < result.cols_; ++j) {
-      for (int k = 0; k < cols_; ++k) {
-        result.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
-      }
-    }
-  }
+template <class T>
+void BasicMatrix<T>::MulMatrix(const ConstView& other) {
+  *this = *this * other;
+}
 
-  // It is more optimal to use moving instead of copying
-  *this = std::move(result);
+/**
+ * Multiply this matrix by another matrix as the policy says, instead of
+ * the global one (see SetMulPolicy in s21_strassen.h).
+ *
+ * @throws std::invalid_argument if the matrix dimensions are incorrect for
+ * multiplication or the crossover size of the policy is less than one
+ */
+template <class T>
+void BasicMatrix<T>::MulMatrix(const BasicMatrix& other,
+                               const S21MulPolicy& policy) {
+  *this = Product(other.View(), policy);
+}
+
+template <class T>
+void BasicMatrix<T>::MulMatrix(const ConstView& other,
+                               const S21MulPolicy& policy) {
+  *this = Product(other, policy);
 }
 
 /**
  * Transposes the S21Matrix.
  *
+ * @details Cache-oblivious blocking over the SIMD tile kernels, see
+ * s21_transpose.h.
+ *
+ * @return the transposed S21Matrix
+ *
+ * @throws None
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::Transpose() const& noexcept {
+  BasicMatrix result(resource_);
+  result.rows_ = cols_;
+  result.cols_ = rows_;
+  result.stride_ = rows_;
+  result.row_capacity_ = cols_;
+  result.AllocateStorage();
+  internal::Transpose(rows_, cols_, matrix_, stride_, result.matrix_,
+                      result.stride_);
+  return result;
+}
+
+/**
+ * Transposes an expiring S21Matrix, in its own buffer when it is square.
+ *
  * @return the transposed S21Matrix
  *
  * @throws None
  */
-S21Matrix S21Matrix::Transpose() const noexcept {
-  S21Matrix result{cols_, rows_};
-  for (int i = 0; i < result.rows_; ++i) {
-    for (int j = 0; j < result.cols_; ++j) {
-      result.matrix_[i][j] = matrix_[j][i];
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::Transpose() && noexcept {
+  if (rows_ != cols_) {
+    return static_cast<const BasicMatrix&>(*this).Transpose();
+  }
+  TransposeInPlace();
+  return std::move(*this);
+}
+
+/**
+ * Transposes the S21Matrix in its own buffer.
+ *
+ * @details Square matrices swap mirrored tiles. Rectangular ones follow the
+ * cycles of the permutation, which needs one bit per element instead of a
+ * second matrix but is slower than Transpose() on large inputs. A heap buffer
+ * with spare capacity is transposed into a new one instead, so that its size
+ * stays row_capacity_ * stride_.
+ *
+ * @throws std::bad_alloc if the bit set of a rectangular matrix cannot be
+ * allocated
+ */
+template <class T>
+void BasicMatrix<T>::TransposeInPlace() {
+  if (rows_ == cols_) {
+    internal::TransposeSquareInPlace(rows_, matrix_, stride_);
+    return;
+  }
+  if (!IsInline() && (stride_ != cols_ || row_capacity_ != rows_)) {
+    *this = static_cast<const BasicMatrix&>(*this).Transpose();
+    return;
+  }
+  if (stride_ != cols_) {
+    // Pack the rows first, front to back never overwrites unread ones
+    for (int i = 1; i < rows_; ++i) {
+      std::copy(Row(i), Row(i) + cols_,
+                matrix_ + static_cast<std::ptrdiff_t>(i) * cols_);
+    }
+  }
+  internal::TransposePackedInPlace(rows_, cols_, matrix_);
+  std::swap(rows_, cols_);
+  stride_ = cols_;
+  row_capacity_ = IsInline() ? kInlineSize / stride_ : rows_;
+}
+
+/**
+ * Conjugate transpose A^H of a complex matrix, the plain transpose of a
+ * real one.
+ *
+ * @return the conjugate transposed S21Matrix
+ *
+ * @throws std::bad_alloc if the result cannot be allocated
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::ConjugateTranspose() const {
+  BasicMatrix result = Transpose();
+  if constexpr (internal::kIsComplex<T>) {
+    for (int i = 0; i < result.rows_; ++i) {
+      T* row = result.Row(i);
+      for (int j = 0; j < result.cols_; ++j) {
+        row[j] = std::conj(row[j]);
+      }
     }
   }
   return result;
@@ -271,146 +468,322 @@ S21Matrix S21Matrix::Transpose() const noexcept {
 /**
  * Calculate the determinant of the S21Matrix.
  *
- * @details I use the Gauss method. O(n^3).
+ * @details I use the Gauss method with partial pivoting, blocked so that
+ * most of the work runs in Gemm (see DecomposeLU). O(n^3). Matrices up to
+ * kClosedFormMaxSize are expanded by the first row. Larger integer matrices
+ * use fraction-free elimination (see BareissDeterminant), exact whenever
+ * the determinant fits T.
  *
  * @return the determinant of the S21Matrix
  *
  * @throws std::invalid_argument if the matrix dimensions are incorrect
  */
-double S21Matrix::Determinant() const {
+template <class T>
+T BasicMatrix<T>::Determinant() const {
   if (rows_ != cols_) {
     throw std::invalid_argument("Incorrect matrix dimensions for Determinant");
   }
 
-  S21Matrix tmp{*this};
-  int sign = 1;
-  double res = 1.0;
-
-  for (int i = 0; i < tmp.rows_ - 1; ++i) {
-    if (!tmp.matrix_[i][i]) {
-      for (int k = 1; k < tmp.rows_; ++k) {
-        if (tmp.matrix_[k][i]) {
-          tmp.SwapRows(i, k);
-          sign *= -1;
-          break;
-        }
-      }
+  const T* r0 = Row(0);
+  switch (rows_) {
+    case 0:
+      return 1;
+    case 1:
+      return r0[0];
+    case 2:
+      return r0[0] * Row(1)[1] - r0[1] * Row(1)[0];
+    case 3: {
+      const T* r1 = Row(1);
+      const T* r2 = Row(2);
+      return r0[0] * (r1[1] * r2[2] - r1[2] * r2[1]) -
+             r0[1] * (r1[0] * r2[2] - r1[2] * r2[0]) +
+             r0[2] * (r1[0] * r2[1] - r1[1] * r2[0]);
     }
-
-    for (int j = i + 1; j < tmp.rows_; ++j) {
-      if (std::abs(tmp.matrix_[i][i]) > kMinEps) {
-        double ratio = tmp.matrix_[j][i] / tmp.matrix_[i][i];
-        for (int l = i; l < tmp.cols_; ++l) {
-          tmp.matrix_[j][l] -= tmp.matrix_[i][l] * ratio;
-        }
+    default:
+      if constexpr (std::is_integral_v<T>) {
+        return BareissDeterminant();
+      } else {
+        return BasicLU<T>(*this).Determinant();
       }
-    }
-  }
-
-  for (int i = 0; i < tmp.rows_; i++) {
-    res *= tmp.matrix_[i][i];
   }
-  return res * sign;
 }
 
 /**
  * Calculate the complements of the S21Matrix.
  *
+ * @details A non-singular matrix gets C = det(A) * (A^-1)^T from a single LU
+ * decomposition, a singular one goes through SingularComplements. Both are
+ * O(n^3). Matrices up to kClosedFormMaxSize expand the minors directly.
+ * Integer matrices stay exact through fraction-free elimination, also in
+ * O(n^3) (see IntegerComplements).
+ *
  * @return The S21Matrix containing the complements.
  *
  * @throws std::invalid_argument if the matrix dimensions are incorrect for
  * CalcComplements
  */
-S21Matrix S21Matrix::CalcComplements() const {
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::CalcComplements() const {
   if (rows_ != cols_) {
     throw std::invalid_argument(
         "Incorrect matrix dimensions for CalcComplements");
   }
 
-  S21Matrix result{rows_, cols_};
+  if constexpr (std::is_integral_v<T>) {
+    return IntegerComplements();
+  } else {
+    if (rows_ <= kClosedFormMaxSize) {
+      BasicMatrix result{rows_, cols_, resource_};
 
-  for (int i = 0; i < result.rows_; ++i) {
-    for (int j = 0; j < result.cols_; ++j) {
-      result(i, j) = Minor(i, j);
+      for (int i = 0; i < result.rows_; ++i) {
+        for (int j = 0; j < result.cols_; ++j) {
+          result.Row(i)[j] = Minor(i, j);
+        }
+      }
+
+      return result;
     }
-  }
 
-  return result;
+    BasicMatrix result{*this, resource_};
+    std::vector<int> pivots(rows_);
+    const T det = result.DecomposeLU(pivots.data());
+    if (BasicLU<T>::HasTinyPivot(result)) {
+      return SingularComplements();
+    }
+
+    std::vector<T> work(rows_);
+    result.InvertLU(pivots.data(), work.data());
+
+    // C = det * (A^-1)^T, transposed in place
+    for (int i = 0; i < rows_; ++i) {
+      T* row = result.Row(i);
+      row[i] *= det;
+      for (int j = i + 1; j < cols_; ++j) {
+        T& mirror = result.Row(j)[i];
+        const T upper = row[j];
+        row[j] = mirror * det;
+        mirror = upper * det;
+      }
+    }
+
+    return result;
+  }
 }
 
 /**
  * Calculate the inverse matrix of the current S21Matrix.
  *
+ * @details Matrices up to kClosedFormMaxSize use the adjugate formula and
+ * count as singular when |det| is below n * epsilon of the product of the
+ * row lengths. Larger ones invert the LU factorization, O(n^3), and count as
+ * singular when a pivot is below n * epsilon of the largest one (see
+ * BasicLU::IsSingular). Neither test depends on the scale of the elements.
+ * An integer matrix has an integer inverse only when its determinant is 1 or
+ * -1, and then it is the adjugate times the determinant.
+ *
  * @return S21Matrix - the inverse matrix
  *
  * @throws std::invalid_argument - if the matrix dimensions are incorrect or the
- * determinant is zero
+ * determinant is zero, or is not 1 or -1 for an integer matrix
  */
-S21Matrix S21Matrix::InverseMatrix() const {
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::InverseMatrix() const {
   if (rows_ != cols_) {
     throw std::invalid_argument(
         "Incorrect matrix dimensions for InverseMatrix");
   }
 
-  double det = Determinant();
+  if constexpr (std::is_integral_v<T>) {
+    BasicMatrix result{rows_, cols_, resource_};
+    const T det = BareissAdjugate(&result);
+    if (!det) {
+      throw std::invalid_argument(
+          "Determinant must be non-zero to calculate Inverse");
+    }
+    if (det != 1 && det != -1) {
+      throw std::invalid_argument(
+          "Determinant of an integer matrix must be 1 or -1 to calculate "
+          "Inverse");
+    }
+    result.MulNumber(det);
+    return result;
+  } else if (rows_ <= kClosedFormMaxSize) {
+    // The determinant is the first row times its cofactors. Like the pivot
+    // test, comparing it with the Hadamard bound prod |row i| ignores the
+    // scale of the elements.
+    BasicMatrix complements = CalcComplements();
+    T det{};
+    Real bound = 1;
+    for (int i = 0; i < rows_; ++i) {
+      det += Row(0)[i] * complements.Row(0)[i];
+      Real squares = 0;
+      for (int j = 0; j < cols_; ++j) {
+        const Real magnitude = std::abs(Row(i)[j]);
+        squares += magnitude * magnitude;
+      }
+      bound *= std::sqrt(squares);
+    }
+    if (Real(std::abs(det)) <= rows_ * kMinEps * bound) {
+      throw std::invalid_argument(
+          "Determinant must be non-zero to calculate Inverse");
+    }
 
-  if (std::abs(det) < kMinEps) {
-    throw std::invalid_argument(
-        "Determinant must be non-zero to calculate Inverse");
-  }
+    BasicMatrix result = complements.Transpose();
+    result.MulNumber(T(1) / det);
+    return result;
+  } else {
+    BasicMatrix result{*this, resource_};
+    std::vector<int> pivots(rows_);
+    result.DecomposeLU(pivots.data());
+    if (BasicLU<T>::HasTinyPivot(result)) {
+      throw std::invalid_argument(
+          "Determinant must be non-zero to calculate Inverse");
+    }
 
-  return S21Matrix(CalcComplements().Transpose() * (1 / det));
+    std::vector<T> work(rows_);
+    result.InvertLU(pivots.data(), work.data());
+    return result;
+  }
 }
 
 /******************************************************************************
  * GETTERS & SETTERS
  ******************************************************************************/
 
-int S21Matrix::GetRows() const noexcept { return rows_; }
-int S21Matrix::GetCols() const noexcept { return cols_; }
+template <class T>
+int BasicMatrix<T>::GetRows() const noexcept { return rows_; }
+template <class T>
+int BasicMatrix<T>::GetCols() const noexcept { return cols_; }
+
+/**
+ * Returns the memory resource of the element buffer.
+ *
+ * @details Matrices computed from this one (products, transposes,
+ * complements, inverses and regrown buffers) use the same resource. A plain
+ * copy uses the global operator new, as std::pmr containers use the default
+ * resource; a move takes the resource along with the buffer.
+ *
+ * @return the resource, std::pmr::new_delete_resource() for operator new,
+ * BufferPoolResource() once a heap buffer came from the enabled pool
+ */
+template <class T>
+std::pmr::memory_resource* BasicMatrix<T>::GetResource() const noexcept {
+  return resource_ ? resource_ : std::pmr::new_delete_resource();
+}
 
 /**
  * Set the number of rows in the S21Matrix.
  *
+ * @details Shrinking keeps the buffer. Growing past the row capacity at
+ * least doubles it, so adding rows one by one is amortized O(cols) each.
+ * New rows are zero.
+ *
  * @param new_rows the new number of rows
  *
  * @throws std::out_of_range if new_rows is negative
  */
-void S21Matrix::SetRows(int new_rows) {
+template <class T>
+void BasicMatrix<T>::SetRows(int new_rows) {
   if (new_rows < 0) {
     throw std::out_of_range("Matrix row size can't be negative");
   }
 
-  S21Matrix tmp{new_rows, cols_};
-  for (int i = 0; i < (new_rows < rows_ ? new_rows : rows_); ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      tmp(i, j) = (*this)(i, j);
-    }
+  if (new_rows > row_capacity_) {
+    Reserve(std::max(new_rows, 2 * row_capacity_), cols_);
   }
-
-  *this = std::move(tmp);
+  for (int i = rows_; i < new_rows; ++i) {
+    std::fill_n(Row(i), cols_, T{});
+  }
+  rows_ = new_rows;
 }
 
 /**
  * Set the number of columns in the matrix.
  *
+ * @details Like SetRows, within the column capacity (the stride) no element
+ * moves. New columns are zero.
+ *
  * @param new_cols the new number of columns
  *
  * @throws std::out_of_range if the new_cols is negative
  */
-void S21Matrix::SetCols(int new_cols) {
+template <class T>
+void BasicMatrix<T>::SetCols(int new_cols) {
   if (new_cols < 0) {
     throw std::out_of_range("Matrix col size can't be negative");
   }
 
-  S21Matrix tmp{rows_, new_cols};
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < (new_cols < cols_ ? new_cols : cols_); ++j) {
-      tmp(i, j) = (*this)(i, j);
+  if (new_cols > stride_) {
+    Reserve(rows_, std::max(new_cols, 2 * stride_));
+  }
+  if (new_cols > cols_) {
+    for (int i = 0; i < rows_; ++i) {
+      std::fill(Row(i) + cols_, Row(i) + new_cols, T{});
     }
   }
+  cols_ = new_cols;
+}
 
-  *this = std::move(tmp);
+/**
+ * Makes room for at least rows x cols elements without changing the size.
+ *
+ * @details Reallocates and copies the elements only when the buffer is too
+ * small in either direction.
+ *
+ * @throws std::out_of_range if rows or cols is negative
+ */
+template <class T>
+void BasicMatrix<T>::Reserve(int rows, int cols) {
+  if (rows < 0 || cols < 0) {
+    throw std::out_of_range("Matrix capacity can't be negative");
+  }
+  if (rows > row_capacity_ || cols > stride_) {
+    *this = WithCapacity(rows, cols);
+  }
+}
+
+/**
+ * Releases the unused capacity, packing the rows into an exactly sized
+ * buffer (inline when it fits).
+ */
+template <class T>
+void BasicMatrix<T>::ShrinkToFit() {
+  if (stride_ != cols_ || (row_capacity_ != rows_ && !IsInline())) {
+    *this = BasicMatrix(*this, resource_);
+  }
+}
+
+/**
+ * Appends a copy of row at the bottom of the matrix.
+ *
+ * @details The row capacity doubles whenever it runs out, so appending is
+ * amortized O(cols). An empty matrix takes the width of the first row. The
+ * row may be a row of this matrix.
+ *
+ * @param row the elements of the new row
+ *
+ * @throws std::invalid_argument if the row size differs from the number of
+ * columns
+ */
+template <class T>
+void BasicMatrix<T>::AppendRow(S21Span<const T> row) {
+  if (rows_ && row.size() != cols_) {
+    throw std::invalid_argument("Incorrect row size for AppendRow");
+  }
+
+  if (rows_ == row_capacity_ || row.size() > stride_) {
+    // Copy the row before the move, it may live in the old buffer
+    BasicMatrix grown =
+        WithCapacity(std::max(1, 2 * row_capacity_), row.size());
+    std::copy_n(row.data(), row.size(), grown.Row(rows_));
+    grown.cols_ = row.size();
+    ++grown.rows_;
+    *this = std::move(grown);
+  } else {
+    std::copy_n(row.data(), row.size(), Row(rows_));
+    cols_ = row.size();
+    ++rows_;
+  }
 }
 
 /******************************************************************************
@@ -427,66 +800,37 @@ void S21Matrix::SetCols(int new_cols) {
  *
  * @throws None
  */
-bool S21Matrix::operator==(const S21Matrix& other) noexcept {
+template <class T>
+bool BasicMatrix<T>::operator==(const BasicMatrix& other) noexcept {
   return EqMatrix(other);
 }
 
-/**
- * Overloads the '+' operator to perform matrix addition.
- *
- * @param other The matrix to be added.
- *
- * @return A new matrix resulting from the addition.
- *
- * @throws None
- */
-S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
-  S21Matrix tmp = *this;
-  tmp.SumMatrix(other);
-  return tmp;
-}
-
-S21Matrix& S21Matrix::operator+=(const S21Matrix& other) {
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const BasicMatrix& other) {
   SumMatrix(other);
   return *this;
 }
 
-/**
- * Overloads the subtraction operator to subtract another S21Matrix.
- *
- * @param other The S21Matrix to subtract from the current matrix.
- *
- * @return A new S21Matrix resulting from the subtraction.
- *
- * @throws None
- */
-S21Matrix S21Matrix::operator-(const S21Matrix& other) const {
-  S21Matrix tmp = *this;
-  tmp.SubMatrix(other);
-  return tmp;
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const ConstView& other) {
+  SumMatrix(other);
+  return *this;
 }
 
-S21Matrix& S21Matrix::operator-=(const S21Matrix& other) {
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const BasicMatrix& other) {
   SubMatrix(other);
   return *this;
 }
 
-/**
- * Overloads the multiplication operator to multiply the matrix by a scalar.
- *
- * @param num the scalar to multiply the matrix by
- *
- * @return a new matrix resulting from the multiplication
- *
- * @throws None
- */
-S21Matrix S21Matrix::operator*(const double& num) const noexcept {
-  S21Matrix tmp = *this;
-  tmp.MulNumber(num);
-  return tmp;
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const ConstView& other) {
+  SubMatrix(other);
+  return *this;
 }
 
-S21Matrix& S21Matrix::operator*=(const double& num) noexcept {
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const T& num) noexcept {
   MulNumber(num);
   return *this;
 }
@@ -498,15 +842,34 @@ S21Matrix& S21Matrix::operator*=(const double& num) noexcept {
  *
  * @return The result of the matrix multiplication
  *
- * @throws None
+ * @throws std::invalid_argument if the matrix dimensions are incorrect for
+ * multiplication
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::operator*(const BasicMatrix& other) const {
+  return *this * other.View();
+}
+
+/**
+ * Multiplies by the elements viewed by other, with the algorithm the global
+ * policy (SetMulPolicy) picks.
+ *
+ * @throws std::invalid_argument if the matrix dimensions are incorrect for
+ * multiplication
  */
-S21Matrix S21Matrix::operator*(const S21Matrix& other) const {
-  S21Matrix tmp = *this;
-  tmp.MulMatrix(other);
-  return tmp;
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::operator*(const ConstView& other) const {
+  return Product(other, GetMulPolicy());
+}
+
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const BasicMatrix& other) {
+  MulMatrix(other);
+  return *this;
 }
 
-S21Matrix& S21Matrix::operator*=(const S21Matrix& other) {
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const ConstView& other) {
   MulMatrix(other);
   return *this;
 }
@@ -522,18 +885,20 @@ S21Matrix& S21Matrix::operator*=(const S21Matrix& other) {
  *
  * @throws std::out_of_range if the indices are outside the matrix
  */
-double S21Matrix::operator()(int i, int j) const {
+template <class T>
+T BasicMatrix<T>::operator()(int i, int j) const {
   if (i < 0 || j < 0 || i >= rows_ || j >= cols_) {
     throw std::out_of_range("Index outside the matrix");
   }
-  return matrix_[i][j];
+  return Row(i)[j];
 }
 
-double& S21Matrix::operator()(int i, int j) {
+template <class T>
+T& BasicMatrix<T>::operator()(int i, int j) {
   if (i < 0 || j < 0 || i >= rows_ || j >= cols_) {
     throw std::out_of_range("Index outside the matrix");
   }
-  return matrix_[i][j];
+  return Row(i)[j];
 }
 
 /******************************************************************************
@@ -541,46 +906,140 @@ double& S21Matrix::operator()(int i, int j) {
  ******************************************************************************/
 
 /**
- * Allocates memory for a matrix of double values.
+ * Allocates one zero-filled, cache-line-aligned buffer for all elements.
+ *
+ * @details Rows are stored contiguously in row-major order, stride_ elements
+ * apart, with room for row_capacity_ of them. Up to kInlineSize elements are
+ * kept in the object itself, which then has room for as many rows as fit,
+ * and an empty matrix has no buffer at all.
  *
  * @param None
  *
  * @return None
  *
- * @throws None
+ * @throws std::bad_alloc if the buffer cannot be allocated
  */
-void S21Matrix::AllocateMatrix() {
-  int i = 0;
-  try {
-    matrix_ = new double* [rows_] {};
-    for (; i < rows_; ++i) {
-      matrix_[i] = new double[cols_]{};
-    }
-  } catch (...) {
-    for (int j = 0; j < i; ++j) {
-      delete[] matrix_[j];
+template <class T>
+void BasicMatrix<T>::AllocateMatrix() {
+  AllocateStorage();
+  if (matrix_) {
+    std::fill_n(matrix_, static_cast<std::size_t>(rows_) * stride_, T{});
+  }
+}
+
+/**
+ * Allocates the element buffer like AllocateMatrix() but leaves it
+ * uninitialized, for callers that overwrite every element.
+ *
+ * @details A matrix without a resource adopts the buffer pool
+ * (s21_buffer_pool.h) when it is enabled.
+ */
+template <class T>
+void BasicMatrix<T>::AllocateStorage() {
+  const std::size_t size = static_cast<std::size_t>(row_capacity_) * stride_;
+  if (!size) {
+    matrix_ = nullptr;
+  } else if (size <= static_cast<std::size_t>(kInlineSize)) {
+    matrix_ = inline_;
+    row_capacity_ = kInlineSize / stride_;
+  } else {
+    if (!resource_ && IsBufferPoolEnabled()) {
+      resource_ = BufferPoolResource();
     }
-    delete[] matrix_;
+    matrix_ = static_cast<T*>(
+        resource_ ? resource_->allocate(sizeof(T) * size, kAlignment)
+                  : ::operator new(sizeof(T) * size,
+                                   std::align_val_t{kAlignment}));
   }
 }
 
 /**
- * Swaps the rows of the S21Matrix.
+ * Releases the element buffer.
  *
- * @param rows_1 the index of the first row to be swapped
- * @param rows_2 the index of the second row to be swapped
+ * @details A heap buffer always holds exactly row_capacity_ * stride_
+ * elements, the size the resource has to be given back.
+ */
+template <class T>
+void BasicMatrix<T>::DeallocateMatrix() noexcept {
+  if (resource_ && matrix_ && !IsInline()) {
+    resource_->deallocate(
+        matrix_,
+        sizeof(T) * static_cast<std::size_t>(row_capacity_) * stride_,
+        kAlignment);
+  } else if (!IsInline()) {
+    ::operator delete(matrix_, std::align_val_t{kAlignment});
+  }
+  matrix_ = nullptr;
+}
+
+/**
+ * Takes over the elements of other and leaves it empty.
  *
- * @throws std::out_of_range if the row index is invalid
+ * @details Expects this matrix to own no buffer.
  */
-void S21Matrix::SwapRows(int rows_1, int rows_2) {
-  if (rows_1 == rows_2) return;
-  if (rows_1 < 0 || rows_1 >= rows_ || rows_2 < 0 || rows_2 >= rows_) {
-    throw std::out_of_range("Invalid row index");
+template <class T>
+void BasicMatrix<T>::StealMatrix(BasicMatrix& other) noexcept {
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  stride_ = other.stride_;
+  row_capacity_ = other.row_capacity_;
+  resource_ = other.resource_;
+  if (other.IsInline()) {
+    std::copy_n(other.inline_, static_cast<std::ptrdiff_t>(rows_) * stride_,
+                inline_);
+    matrix_ = inline_;
+  } else {
+    matrix_ = other.matrix_;
   }
+  other.rows_ = 0;
+  other.cols_ = 0;
+  other.stride_ = 0;
+  other.row_capacity_ = 0;
+  other.matrix_ = nullptr;
+}
 
-  for (int j = 0; j < cols_; ++j) {
-    std::swap((*this)(rows_1, j), (*this)(rows_2, j));
+/**
+ * Copies the matrix into a buffer of at least rows x cols elements, keeping
+ * the current capacity where it is larger.
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::WithCapacity(int rows, int cols) const {
+  BasicMatrix result(resource_);
+  result.rows_ = rows_;
+  result.cols_ = cols_;
+  result.stride_ = std::max(cols, stride_);
+  result.row_capacity_ = std::max(rows, row_capacity_);
+  result.AllocateStorage();
+  for (int i = 0; i < rows_; ++i) {
+    std::copy_n(Row(i), cols_, result.Row(i));
   }
+  return result;
+}
+
+/**
+ * Multiplies by the elements viewed by other with the given policy.
+ *
+ * @details Rows of the view are read in place; a view with non-adjacent
+ * columns, e.g. a transposed one, is packed into a matrix first.
+ *
+ * @throws std::invalid_argument if the matrix dimensions are incorrect for
+ * multiplication or the crossover size of the policy is less than one
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::Product(const ConstView& other,
+                                       const S21MulPolicy& policy) const {
+  if (cols_ != other.GetRows()) {
+    throw std::invalid_argument(
+        "Incorrect matrix dimensions for Multiplication");
+  }
+  if (other.GetColStride() != 1) {
+    return Product(BasicMatrix(other).View(), policy);
+  }
+  BasicMatrix result{rows_, other.GetCols(), resource_};
+  internal::Multiply(policy, rows_, other.GetCols(), cols_, matrix_, stride_,
+                     other.data(), other.GetRowStride(), result.matrix_,
+                     result.stride_);
+  return result;
 }
 
 /**
@@ -593,19 +1052,489 @@ void S21Matrix::SwapRows(int rows_1, int rows_2) {
  *
  * @throws None
  */
-double S21Matrix::Minor(int i, int j) const {
-  S21Matrix result{rows_ - 1, rows_ - 1};
-  double res = 0;
+template <class T>
+T BasicMatrix<T>::Minor(int i, int j) const {
+  const int n = rows_ - 1;
+  BasicMatrix result{n, n};
+  T res = 0;
 
-  for (int k = 0; k < rows_ - 1; ++k) {
-    for (int l = 0; l < rows_ - 1; ++l) {
-      result(k, l) = matrix_[k < i ? k : k + 1][l < j ? l : l + 1];
+  // The four blocks around row i and column j
+  result.Block(0, 0, i, j).Assign(Block(0, 0, i, j));
+  result.Block(0, j, i, n - j).Assign(Block(0, j + 1, i, n - j));
+  result.Block(i, 0, n - i, j).Assign(Block(i + 1, 0, n - i, j));
+  result.Block(i, j, n - i, n - j).Assign(Block(i + 1, j + 1, n - i, n - j));
+
+  res = (i + j) % 2 ? -result.Determinant() : result.Determinant();
+
+  return res;
+}
+
+/**
+ * Calculates the determinant of an integer matrix by Bareiss elimination.
+ *
+ * @details Every intermediate entry is a minor of the matrix and every
+ * division is exact, so the result is exact as long as the minors fit T.
+ * The products of two of them are formed in twice the width of T. O(n^3).
+ *
+ * @return the determinant of the matrix
+ *
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+T BasicMatrix<T>::BareissDeterminant() const {
+  const int n = rows_;
+  std::vector<Wide> m(static_cast<std::size_t>(n) * n);
+  for (int i = 0; i < n; ++i) {
+    std::copy_n(Row(i), n, m.begin() + static_cast<std::ptrdiff_t>(i) * n);
+  }
+  auto at = [&m, n](int i, int j) -> Wide& {
+    return m[static_cast<std::size_t>(i) * n + j];
+  };
+
+  Wide sign = 1, previous = 1;
+  for (int k = 0; k < n - 1; ++k) {
+    if (at(k, k) == Wide{}) {
+      int pivot = k + 1;
+      while (pivot < n && at(pivot, k) == Wide{}) ++pivot;
+      if (pivot == n) return T{};
+      for (int j = k; j < n; ++j) std::swap(at(k, j), at(pivot, j));
+      sign = -sign;
+    }
+    for (int i = k + 1; i < n; ++i) {
+      for (int j = k + 1; j < n; ++j) {
+        at(i, j) = (at(i, j) * at(k, k) - at(i, k) * at(k, j)) / previous;
+      }
     }
+    previous = at(k, k);
   }
+  return static_cast<T>(sign * at(n - 1, n - 1));
+}
 
-  res = result.Determinant() * ((i + j) % 2 ? -1 : 1);
+/**
+ * Calculates the adjugate and the determinant of an integer matrix by
+ * fraction-free (Bareiss) Gauss-Jordan elimination of [A | I].
+ *
+ * @details Above and below every pivot the rows are updated as in
+ * BareissDeterminant, so every division stays exact. The elimination ends
+ * with [d * I | d * A^-1] where d = +-det(A), and d * A^-1 is the adjugate
+ * up to the sign of the row swaps. O(n^3).
+ *
+ * @param adjugate n x n matrix that receives adj(A) unless A is singular
+ *
+ * @return the determinant, zero for a singular matrix
+ *
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+T BasicMatrix<T>::BareissAdjugate(BasicMatrix* adjugate) const {
+  const int n = rows_;
+  if (n == 0) return T(1);
+  const int width = 2 * n;
+  std::vector<Wide> m(static_cast<std::size_t>(n) * width);
+  for (int i = 0; i < n; ++i) {
+    std::copy_n(Row(i), n, m.begin() + static_cast<std::ptrdiff_t>(i) * width);
+    m[static_cast<std::size_t>(i) * width + n + i] = 1;
+  }
+  auto at = [&m, width](int i, int j) -> Wide& {
+    return m[static_cast<std::size_t>(i) * width + j];
+  };
+
+  Wide sign = 1, previous = 1;
+  for (int k = 0; k < n; ++k) {
+    if (at(k, k) == Wide{}) {
+      int pivot = k + 1;
+      while (pivot < n && at(pivot, k) == Wide{}) ++pivot;
+      if (pivot == n) return T{};
+      for (int j = 0; j < width; ++j) std::swap(at(k, j), at(pivot, j));
+      sign = -sign;
+    }
+    for (int i = 0; i < n; ++i) {
+      if (i == k) continue;
+      for (int j = 0; j < width; ++j) {
+        if (j == k) continue;
+        at(i, j) = (at(i, j) * at(k, k) - at(i, k) * at(k, j)) / previous;
+      }
+      at(i, k) = 0;
+    }
+    previous = at(k, k);
+  }
 
-  return res;
+  for (int i = 0; i < n; ++i) {
+    T* row = adjugate->Row(i);
+    for (int j = 0; j < n; ++j) {
+      row[j] = static_cast<T>(sign * at(i, n + j));
+    }
+  }
+  return static_cast<T>(sign * previous);
 }
 
+/**
+ * Finds the rank of an integer matrix by Bareiss elimination with complete
+ * pivoting, exactly. O(n^3).
+ *
+ * @param free_row, free_col receive, for a rank of n - 1, the row and the
+ * column that no pivot took: their minor is non-zero
+ *
+ * @return the rank of the matrix
+ *
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+int BasicMatrix<T>::BareissRank(int* free_row, int* free_col) const {
+  const int n = rows_;
+  std::vector<Wide> m(static_cast<std::size_t>(n) * n);
+  for (int i = 0; i < n; ++i) {
+    std::copy_n(Row(i), n, m.begin() + static_cast<std::ptrdiff_t>(i) * n);
+  }
+  auto at = [&m, n](int i, int j) -> Wide& {
+    return m[static_cast<std::size_t>(i) * n + j];
+  };
+  std::vector<int> rows(n), cols(n);
+  for (int k = 0; k < n; ++k) rows[k] = cols[k] = k;
+
+  Wide previous = 1;
+  int rank = 0;
+  for (; rank < n; ++rank) {
+    const int k = rank;
+    int pivot_row = k, pivot_col = k;
+    while (pivot_row < n && at(pivot_row, pivot_col) == Wide{}) {
+      if (++pivot_col == n) {
+        pivot_col = k;
+        ++pivot_row;
+      }
+    }
+    if (pivot_row == n) break;
+    for (int j = 0; j < n; ++j) std::swap(at(k, j), at(pivot_row, j));
+    for (int i = 0; i < n; ++i) std::swap(at(i, k), at(i, pivot_col));
+    std::swap(rows[k], rows[pivot_row]);
+    std::swap(cols[k], cols[pivot_col]);
+    for (int i = k + 1; i < n; ++i) {
+      for (int j = k + 1; j < n; ++j) {
+        at(i, j) = (at(i, j) * at(k, k) - at(i, k) * at(k, j)) / previous;
+      }
+    }
+    previous = at(k, k);
+  }
+  if (n > 0) {
+    *free_row = rows[n - 1];
+    *free_col = cols[n - 1];
+  }
+  return rank;
+}
+
+/**
+ * Calculates the complements of an integer matrix exactly, in O(n^3).
+ *
+ * @details A non-singular matrix gets C = adj(A)^T from BareissAdjugate.
+ * For rank n - 1 the complements have rank one, so
+ * C[i][j] * C[p][q] = C[p][j] * C[i][q] for the row p and the column q
+ * whose minor is non-zero. Row p of C does not depend on row p of A, so it
+ * is row p of the complements of A with row p replaced by e[q], a matrix
+ * with the non-zero determinant C[p][q]; column q likewise. Below rank
+ * n - 1 every minor vanishes.
+ *
+ * @return the complements matrix
+ *
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::IntegerComplements() const {
+  const int n = rows_;
+  BasicMatrix result{n, n, resource_};
+  if (BareissAdjugate(&result) != T{}) {
+    result.TransposeInPlace();
+    return result;
+  }
+
+  int p = 0, q = 0;
+  if (BareissRank(&p, &q) < n - 1) return result;
+
+  // Columns p and q of the adjugates of the two bordered matrices
+  BasicMatrix bordered{*this};
+  BasicMatrix adjugate{n, n};
+  std::fill_n(bordered.Row(p), n, T{});
+  bordered.Row(p)[q] = 1;
+  const T pivot = bordered.BareissAdjugate(&adjugate);
+  std::vector<T> row_p(n), col_q(n);
+  for (int j = 0; j < n; ++j) row_p[j] = adjugate.Row(j)[p];
+
+  bordered = *this;
+  for (int i = 0; i < n; ++i) bordered.Row(i)[q] = T{};
+  bordered.Row(p)[q] = 1;
+  bordered.BareissAdjugate(&adjugate);
+  for (int i = 0; i < n; ++i) col_q[i] = adjugate.Row(q)[i];
+
+  for (int i = 0; i < n; ++i) {
+    T* row = result.Row(i);
+    for (int j = 0; j < n; ++j) {
+      row[j] = static_cast<T>(Wide(row_p[j]) * col_q[i] / pivot);
+    }
+  }
+  return result;
+}
+
+/**
+ * Calculate the complements of a singular S21Matrix.
+ *
+ * @details The complements matrix of a singular A is zero when rank(A) < n - 1
+ * and y * x^T scaled by one explicitly computed minor when rank(A) = n - 1,
+ * where A * x = 0 and y^T * A = 0. The rank and both null vectors come from
+ * a rank-revealing LU decomposition with complete pivoting. O(n^3).
+ *
+ * @return The S21Matrix containing the complements.
+ *
+ * @throws None
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::SingularComplements() const {
+  const int n = rows_;
+  BasicMatrix lu{*this, resource_};
+  std::vector<int> row_pivots(n), col_pivots(n);
+  const int rank = lu.DecomposeLUFull(row_pivots.data(), col_pivots.data());
+
+  BasicMatrix result{n, n, resource_};
+  if (rank < n - 1) return result;
+  // A full rank here is barely so; its last pivot is dropped like a zero one
+
+  // U * z = 0 with z[n-1] = 1, then x = Q * z
+  std::vector<T> x(n), y(n);
+  x[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i) {
+    const T* row = lu.Row(i);
+    T sum = row[n - 1];
+    for (int k = i + 1; k < n - 1; ++k) {
+      sum += row[k] * x[k];
+    }
+    x[i] = -sum / row[i];
+  }
+
+  // L^T * w = e[n-1], then y = P^T * w
+  y[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i) {
+    T sum = 0;
+    for (int k = i + 1; k < n; ++k) {
+      sum += lu.Row(k)[i] * y[k];
+    }
+    y[i] = -sum;
+  }
+
+  for (int k = n - 1; k >= 0; --k) {
+    std::swap(x[k], x[col_pivots[k]]);
+    std::swap(y[k], y[row_pivots[k]]);
+  }
+
+  // Scale from the largest entry of y * x^T, computed directly
+  const int i_max = static_cast<int>(
+      std::max_element(y.begin(), y.end(),
+                       [](T a, T b) {
+                         return std::abs(a) < std::abs(b);
+                       }) -
+      y.begin());
+  const int j_max = static_cast<int>(
+      std::max_element(x.begin(), x.end(),
+                       [](T a, T b) {
+                         return std::abs(a) < std::abs(b);
+                       }) -
+      x.begin());
+  const T scale = Minor(i_max, j_max) / (y[i_max] * x[j_max]);
+
+  for (int i = 0; i < n; ++i) {
+    T* row = result.Row(i);
+    for (int j = 0; j < n; ++j) {
+      row[j] = scale * y[i] * x[j];
+    }
+  }
+
+  return result;
+}
+
+/**
+ * Factorizes the square matrix in place as P * A = L * U with partial
+ * pivoting.
+ *
+ * @details L (unit diagonal, not stored) ends up below the diagonal and U on
+ * and above it. pivots[k] receives the row swapped with row k at step k.
+ * Blocked right-looking variant: each kLUBlockSize-wide panel is factorized
+ * column by column, the block row of U is solved against the panel's L, and
+ * the trailing matrix gets one rank-kLUBlockSize update through Gemm.
+ *
+ * @param pivots array of rows_ row indices
+ *
+ * @return the determinant of the matrix
+ *
+ * @throws std::bad_alloc if Gemm cannot allocate its packing buffers
+ */
+template <class T>
+T BasicMatrix<T>::DecomposeLU(int* pivots) {
+  const auto axpy = internal::Kernels<T>().axpy;
+  const int n = rows_;
+  T det = 1;
+
+  for (int k0 = 0; k0 < n; k0 += kLUBlockSize) {
+    const int k1 = std::min(k0 + kLUBlockSize, n);
+
+    // Panel: rows k0.., columns k0..k1, swapping whole rows
+    for (int k = k0; k < k1; ++k) {
+      int pivot = k;
+      for (int i = k + 1; i < n; ++i) {
+        if (std::abs(Row(i)[k]) > std::abs(Row(pivot)[k])) pivot = i;
+      }
+      pivots[k] = pivot;
+      if (pivot != k) {
+        std::swap_ranges(Row(k), Row(k) + cols_, Row(pivot));
+        det = -det;
+      }
+
+      const T* pivot_row = Row(k);
+      det *= pivot_row[k];
+      if (pivot_row[k] == T{}) continue;
+
+      for (int i = k + 1; i < n; ++i) {
+        T* row = Row(i);
+        row[k] /= pivot_row[k];
+        axpy(k1 - k - 1, -row[k], pivot_row + k + 1, row + k + 1);
+      }
+    }
+    if (k1 == n) break;
+
+    // U12 = L11^-1 * A12
+    for (int i = k0 + 1; i < k1; ++i) {
+      T* row = Row(i);
+      for (int k = k0; k < i; ++k) {
+        axpy(n - k1, -row[k], Row(k) + k1, row + k1);
+      }
+    }
+
+    // A22 -= L21 * U12
+    internal::Gemm(n - k1, n - k1, k1 - k0, -1.0, Row(k1) + k0, stride_,
+                   Row(k0) + k1, stride_, Row(k1) + k1, stride_);
+  }
+
+  return det;
+}
+
+/**
+ * Factorizes the square matrix in place as P * A * Q = L * U with complete
+ * pivoting, stopping at the numerical rank.
+ *
+ * @details At step k rows k and row_pivots[k] and columns k and
+ * col_pivots[k] are swapped. Pivots below rows_ * kMinEps times the first
+ * pivot count as zero; the remaining steps record identity swaps.
+ *
+ * @param row_pivots array of rows_ row indices
+ * @param col_pivots array of rows_ column indices
+ *
+ * @return the numerical rank of the matrix
+ *
+ * @throws None
+ */
+template <class T>
+int BasicMatrix<T>::DecomposeLUFull(int* row_pivots, int* col_pivots) noexcept {
+  const auto axpy = internal::Kernels<T>().axpy;
+  Real tolerance = 0;
+
+  for (int k = 0; k < rows_; ++k) {
+    int pivot_row = k, pivot_col = k;
+    for (int i = k; i < rows_; ++i) {
+      const T* row = Row(i);
+      for (int j = k; j < cols_; ++j) {
+        if (std::abs(row[j]) > std::abs(Row(pivot_row)[pivot_col])) {
+          pivot_row = i;
+          pivot_col = j;
+        }
+      }
+    }
+
+    const Real pivot = std::abs(Row(pivot_row)[pivot_col]);
+    if (!k) tolerance = rows_ * kMinEps * pivot;
+    if (!pivot || pivot <= tolerance) {
+      for (int r = k; r < rows_; ++r) {
+        row_pivots[r] = r;
+        col_pivots[r] = r;
+      }
+      return k;
+    }
+
+    row_pivots[k] = pivot_row;
+    col_pivots[k] = pivot_col;
+    std::swap_ranges(Row(k), Row(k) + cols_, Row(pivot_row));
+    if (pivot_col != k) {
+      for (int i = 0; i < rows_; ++i) {
+        std::swap(Row(i)[k], Row(i)[pivot_col]);
+      }
+    }
+
+    const T* row_k = Row(k);
+    for (int i = k + 1; i < rows_; ++i) {
+      T* row = Row(i);
+      row[k] /= row_k[k];
+      axpy(cols_ - k - 1, -row[k], row_k + k + 1, row + k + 1);
+    }
+  }
+
+  return rows_;
+}
+
+/**
+ * Replaces the LU factors produced by DecomposeLU with the inverse matrix.
+ *
+ * @details Inverts U row by row, solves X * L = U^-1 column by column and
+ * undoes the row pivoting as column swaps, as LAPACK getri does.
+ *
+ * @param pivots row swaps recorded by DecomposeLU
+ * @param work workspace of rows_ doubles
+ *
+ * @throws None
+ */
+template <class T>
+void BasicMatrix<T>::InvertLU(const int* pivots, T* work) noexcept {
+  const int n = rows_;
+  const auto axpy = internal::Kernels<T>().axpy;
+
+  // U^-1, bottom row first: X[i][i+1:] = -(U[i][i+1:] * X[i+1:][i+1:]) / u_ii
+  for (int i = n - 1; i >= 0; --i) {
+    T* row = Row(i);
+    std::fill(work + i + 1, work + n, T{});
+    for (int k = i + 1; k < n; ++k) {
+      axpy(n - k, row[k], Row(k) + k, work + k);
+    }
+    row[i] = T(1) / row[i];
+    for (int j = i + 1; j < n; ++j) {
+      row[j] = -row[i] * work[j];
+    }
+  }
+
+  // X * L = U^-1, last column first
+  for (int j = n - 1; j >= 0; --j) {
+    for (int i = j + 1; i < n; ++i) {
+      work[i] = Row(i)[j];
+      Row(i)[j] = 0;
+    }
+    for (int r = 0; r < n; ++r) {
+      const T* row = Row(r);
+      T sum = 0;
+      for (int i = j + 1; i < n; ++i) {
+        sum += row[i] * work[i];
+      }
+      Row(r)[j] -= sum;
+    }
+  }
+
+  // A^-1 = X * P
+  for (int j = n - 2; j >= 0; --j) {
+    if (pivots[j] == j) continue;
+    for (int r = 0; r < n; ++r) {
+      std::swap(Row(r)[j], Row(r)[pivots[j]]);
+    }
+  }
+}
+
+template class BasicMatrix<float>;
+template class BasicMatrix<double>;
+template class BasicMatrix<long double>;
+template class BasicMatrix<int>;
+template class BasicMatrix<long long>;
+template class BasicMatrix<std::complex<float>>;
+template class BasicMatrix<std::complex<double>>;
+
 }  // namespace S21
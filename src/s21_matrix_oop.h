@@ -16,68 +16,311 @@
 #ifndef CPP1_S21_MATRIXPLUS_S21_MATRIX_OOP_H_
 #define CPP1_S21_MATRIXPLUS_S21_MATRIX_OOP_H_
 
-#include <algorithm>  // std::copy
-#include <cmath>      // std::abs
+#include <algorithm>        // std::copy | std::transform
+#include <cmath>            // std::abs | std::sqrt
+#include <cstddef>          // std::size_t | std::ptrdiff_t
+#include <cstring>          // std::memcpy
 #include <iostream>
-#include <limits>     // kMinEps
-#include <stdexcept>  // out_of_range | invalid_argument
-#include <utility>    // std::move | std::swap
+#include <limits>           // kMinEps
+#include <memory_resource>  // std::pmr::memory_resource
+#include <new>              // std::align_val_t
+#include <stdexcept>        // out_of_range | invalid_argument
+#include <type_traits>      // std::enable_if_t | std::is_convertible_v
+#include <utility>          // std::move | std::swap
+#include <vector>           // std::vector
+
+#include "s21_complex.h"
+#include "s21_matrix_view.h"
+#include "s21_strassen.h"
 
 namespace S21 {
 
-class S21Matrix {
+template <class T>
+class BasicLU;
+template <class E>
+struct MatrixExpr;
+
+/**
+ * Non-owning view of contiguous elements, such as one row of a matrix.
+ *
+ * @details Indexing is unchecked unless S21_MATRIX_DEBUG is defined.
+ */
+template <class T>
+class S21Span {
+ public:
+  S21Span(T* data, int size) noexcept : data_(data), size_(size) {}
+  template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  S21Span(S21Span<U> other) noexcept  // NOLINT: span<T> to span<const T>
+      : data_(other.data()), size_(other.size()) {}
+
+  T* data() const noexcept { return data_; }
+  int size() const noexcept { return size_; }
+  T* begin() const noexcept { return data_; }
+  T* end() const noexcept { return data_ + size_; }
+  T& operator[](int i) const {
+#ifdef S21_MATRIX_DEBUG
+    if (i < 0 || i >= size_) throw std::out_of_range("Index outside the span");
+#endif
+    return data_[i];
+  }
+
+ private:
+  T* data_;
+  int size_;
+};
+
+namespace internal {
+template <class T>
+class MatrixRef;
+template <class T>
+class MatrixValue;
+}  // namespace internal
+
+/**
+ * Dense row-major matrix of T.
+ *
+ * @details T is float, double, long double, int, long long,
+ * std::complex<float> or std::complex<double>; the library is compiled for
+ * exactly these (see the explicit instantiations at the end of
+ * s21_matrix_oop.cc). S21Matrix is BasicMatrix<double> and S21ComplexMatrix
+ * is BasicMatrix<std::complex<double>>. Floating and complex types compare
+ * pivot magnitudes against their own epsilon. Integer matrices are exact:
+ * their determinants and complements avoid division, and only unimodular
+ * ones (determinant 1 or -1) have an inverse.
+ */
+template <class T>
+class BasicMatrix {
  public:
-  S21Matrix();
-  S21Matrix(int rows, int cols);
-  S21Matrix(const S21Matrix& other);
-  S21Matrix(S21Matrix&& other) noexcept;
-  S21Matrix& operator=(S21Matrix&& other) noexcept;
-  S21Matrix& operator=(const S21Matrix& other);
-  S21Matrix(std::initializer_list<std::initializer_list<double>> initList);
-  ~S21Matrix() noexcept;
+  using value_type = T;
+  using ConstView = BasicConstMatrixView<T>;
+  using MutableView = BasicMatrixView<T>;
+
+  BasicMatrix();
+  BasicMatrix(int rows, int cols);
+  BasicMatrix(const BasicMatrix& other);
+  BasicMatrix(BasicMatrix&& other) noexcept;
+  BasicMatrix& operator=(BasicMatrix&& other) noexcept;
+  BasicMatrix& operator=(const BasicMatrix& other);
+  BasicMatrix(std::initializer_list<std::initializer_list<T>> initList);
+  explicit BasicMatrix(const ConstView& view);
+  template <class U>
+  explicit BasicMatrix(const BasicMatrix<U>& other,
+                       std::pmr::memory_resource* resource = nullptr);
+  template <class E>
+  BasicMatrix(const MatrixExpr<E>& expr);  // NOLINT: implicit by design
+  template <class E>
+  BasicMatrix(const MatrixExpr<E>& expr, std::pmr::memory_resource* resource);
+  template <class E>
+  BasicMatrix(MatrixExpr<E>&& expr);  // NOLINT: implicit by design
+  template <class E>
+  BasicMatrix& operator=(const MatrixExpr<E>& expr);
+  template <class E>
+  BasicMatrix& operator=(MatrixExpr<E>&& expr);
+  ~BasicMatrix() noexcept;
+
+  // Storage from a memory resource instead of the global operator new; see
+  // GetResource() for which resource other matrices take
+  explicit BasicMatrix(std::pmr::memory_resource* resource) noexcept;
+  BasicMatrix(int rows, int cols, std::pmr::memory_resource* resource);
+  BasicMatrix(const BasicMatrix& other, std::pmr::memory_resource* resource);
+  std::pmr::memory_resource* GetResource() const noexcept;
 
   // Main methods
-  bool EqMatrix(const S21Matrix& other) noexcept;
-  void SumMatrix(const S21Matrix& other);
-  void SubMatrix(const S21Matrix& other);
-  void MulNumber(const double num) noexcept;
-  void MulMatrix(const S21Matrix& other);
-  S21Matrix Transpose() const noexcept;
-  double Determinant() const;
-  S21Matrix CalcComplements() const;
-  S21Matrix InverseMatrix() const;
+  bool EqMatrix(const BasicMatrix& other) noexcept;
+  void SumMatrix(const BasicMatrix& other);
+  void SumMatrix(const ConstView& other);
+  void SubMatrix(const BasicMatrix& other);
+  void SubMatrix(const ConstView& other);
+  void MulNumber(const T num) noexcept;
+  void MulMatrix(const BasicMatrix& other);
+  void MulMatrix(const ConstView& other);
+  void MulMatrix(const BasicMatrix& other, const S21MulPolicy& policy);
+  void MulMatrix(const ConstView& other, const S21MulPolicy& policy);
+  BasicMatrix Transpose() const& noexcept;
+  BasicMatrix Transpose() && noexcept;
+  void TransposeInPlace();
+  BasicMatrix ConjugateTranspose() const;
+  T Determinant() const;
+  BasicMatrix CalcComplements() const;
+  BasicMatrix InverseMatrix() const;
 
   int GetRows() const noexcept;
   int GetCols() const noexcept;
   void SetRows(int new_rows);
   void SetCols(int now_cols);
 
-  // Overloaded methods
-  bool operator==(const S21Matrix& other) noexcept;
-  S21Matrix operator+(const S21Matrix& other) const;
-  S21Matrix& operator+=(const S21Matrix& other);
-  S21Matrix operator-(const S21Matrix& other) const;
-  S21Matrix& operator-=(const S21Matrix& other);
-  S21Matrix operator*(const double& num) const noexcept;
-  S21Matrix& operator*=(const double& num) noexcept;
-  S21Matrix operator*(const S21Matrix& other) const;
-  S21Matrix& operator*=(const S21Matrix& other);
-  double operator()(int i, int j) const;
-  double& operator()(int i, int j);
+  // Capacity: rows and columns the buffer holds without reallocating
+  int GetRowCapacity() const noexcept { return row_capacity_; }
+  int GetColCapacity() const noexcept { return stride_; }
+  void Reserve(int rows, int cols);
+  void ShrinkToFit();
+  void AppendRow(S21Span<const T> row);
+
+  // Overloaded methods, +, - and * by a number are lazy (s21_matrix_expr.h)
+  bool operator==(const BasicMatrix& other) noexcept;
+  BasicMatrix& operator+=(const BasicMatrix& other);
+  BasicMatrix& operator+=(const ConstView& other);
+  template <class E>
+  BasicMatrix& operator+=(const MatrixExpr<E>& expr);
+  BasicMatrix& operator-=(const BasicMatrix& other);
+  BasicMatrix& operator-=(const ConstView& other);
+  template <class E>
+  BasicMatrix& operator-=(const MatrixExpr<E>& expr);
+  BasicMatrix& operator*=(const T& num) noexcept;
+  BasicMatrix operator*(const BasicMatrix& other) const;
+  BasicMatrix operator*(const ConstView& other) const;
+  BasicMatrix& operator*=(const BasicMatrix& other);
+  BasicMatrix& operator*=(const ConstView& other);
+  T operator()(int i, int j) const;
+  T& operator()(int i, int j);
+
+  // Unchecked element access for hot loops; S21_MATRIX_DEBUG restores the
+  // bounds checks of operator(). Rows are GetStride() elements apart.
+  T At(int i, int j) const noexcept(!kCheckIndices) {
+    CheckIndex(i, j);
+    return Row(i)[j];
+  }
+  T& At(int i, int j) noexcept(!kCheckIndices) {
+    CheckIndex(i, j);
+    return Row(i)[j];
+  }
+  const T* RowPtr(int i) const noexcept(!kCheckIndices) {
+    CheckIndex(i, 0);
+    return Row(i);
+  }
+  T* RowPtr(int i) noexcept(!kCheckIndices) {
+    CheckIndex(i, 0);
+    return Row(i);
+  }
+  S21Span<const T> RowSpan(int i) const noexcept(!kCheckIndices) {
+    return S21Span<const T>(RowPtr(i), cols_);
+  }
+  S21Span<T> RowSpan(int i) noexcept(!kCheckIndices) {
+    return S21Span<T>(RowPtr(i), cols_);
+  }
+  const T* data() const noexcept { return matrix_; }
+  T* data() noexcept { return matrix_; }
+  int GetStride() const noexcept { return stride_; }
+
+  // Non-owning views of the elements (s21_matrix_view.h)
+  ConstView View() const noexcept {
+    return ConstView(matrix_, rows_, cols_, stride_);
+  }
+  MutableView View() noexcept {
+    return MutableView(matrix_, rows_, cols_, stride_);
+  }
+  ConstView Block(int row, int col, int rows, int cols) const {
+    return View().Block(row, col, rows, cols);
+  }
+  MutableView Block(int row, int col, int rows, int cols) {
+    return View().Block(row, col, rows, cols);
+  }
 
  private:
-  constexpr static const double kMinEps =
-      std::numeric_limits<double>::epsilon();
+  friend class BasicLU<T>;
+  friend class internal::MatrixRef<T>;
+  friend class internal::MatrixValue<T>;
+
+  using Real = internal::RealType<T>;
+
+  // Pivots below this relative size count as zero; 0 for integer types
+  constexpr static const Real kMinEps = std::numeric_limits<Real>::epsilon();
+  // Holds the product of two minors of an integer matrix exactly; only the
+  // fraction-free eliminations of integer matrices use it
+  using Wide = std::conditional_t<
+      !std::is_integral_v<T>, T,
+      std::conditional_t<(sizeof(T) < sizeof(long long)), long long,
+                         __int128>>;
+#ifdef S21_MATRIX_DEBUG
+  constexpr static const bool kCheckIndices = true;
+#else
+  constexpr static const bool kCheckIndices = false;
+#endif
+  // Alignment of the heap element buffer, one cache line
+  constexpr static const std::size_t kAlignment = 64;
+  // Matrices up to this many elements live in inline_ and never allocate
+  constexpr static const int kInlineSize = 16;
+  // Up to this size Determinant and InverseMatrix use closed formulas, which
+  // are cheaper than the factorization and exact for small integer matrices
+  constexpr static const int kClosedFormMaxSize = 3;
+  // Panel width of the blocked LU decomposition
+  constexpr static const int kLUBlockSize = 64;
 
   void AllocateMatrix();
+  void AllocateStorage();
+  void DeallocateMatrix() noexcept;
+  void StealMatrix(BasicMatrix& other) noexcept;
+  BasicMatrix WithCapacity(int rows, int cols) const;
+  bool IsInline() const noexcept { return matrix_ == inline_; }
+
+  void CheckIndex([[maybe_unused]] int i,
+                  [[maybe_unused]] int j) const noexcept(!kCheckIndices) {
+#ifdef S21_MATRIX_DEBUG
+    if (i < 0 || j < 0 || i >= rows_ || j >= cols_) {
+      throw std::out_of_range("Index outside the matrix");
+    }
+#endif
+  }
+  T* Row(int i) noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(i) * stride_;
+  }
+  const T* Row(int i) const noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(i) * stride_;
+  }
 
   int rows_, cols_;
-  double** matrix_;
+  int stride_;        // leading dimension, also the column capacity
+  int row_capacity_;  // rows the buffer holds, rows_ of them are in use
+  std::pmr::memory_resource* resource_;  // nullptr: global operator new
+  T* matrix_;         // row-major buffer of row_capacity_ * stride_ elements
+  T inline_[kInlineSize];  // storage of small matrices, see matrix_
 
-  void SwapRows(int rows_1, int rows_2);
-  double Minor(int i, int j) const;
+  T Minor(int i, int j) const;
+  T BareissDeterminant() const;
+  T BareissAdjugate(BasicMatrix* adjugate) const;
+  int BareissRank(int* free_row, int* free_col) const;
+  BasicMatrix IntegerComplements() const;
+  BasicMatrix SingularComplements() const;
+  BasicMatrix Product(const ConstView& other, const S21MulPolicy& policy) const;
+  T DecomposeLU(int* pivots);
+  int DecomposeLUFull(int* row_pivots, int* col_pivots) noexcept;
+  void InvertLU(const int* pivots, T* work) noexcept;
+  template <class E, class Store>
+  void Evaluate(const E& expr, Store store) noexcept;
 };
 
+using S21Matrix = BasicMatrix<double>;
+using S21ComplexMatrix = BasicMatrix<std::complex<double>>;
+
+extern template class BasicMatrix<float>;
+extern template class BasicMatrix<double>;
+extern template class BasicMatrix<long double>;
+extern template class BasicMatrix<int>;
+extern template class BasicMatrix<long long>;
+extern template class BasicMatrix<std::complex<float>>;
+extern template class BasicMatrix<std::complex<double>>;
+
+/**
+ * Converts every element of other to T, as static_cast does.
+ *
+ * @param other matrix of another element type
+ * @param resource where the buffer comes from, nullptr for operator new
+ */
+template <class T>
+template <class U>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix<U>& other,
+                            std::pmr::memory_resource* resource)
+    : BasicMatrix(other.GetRows(), other.GetCols(), resource) {
+  for (int i = 0; i < rows_; ++i) {
+    const U* row = other.data() + static_cast<std::ptrdiff_t>(i) *
+                                      other.GetStride();
+    std::transform(row, row + cols_, Row(i),
+                   [](U value) { return static_cast<T>(value); });
+  }
+}
+
 }  // namespace S21
 
+#include "s21_matrix_expr.h"
+
 #endif  // CPP1_S21_MATRIXPLUS_S21_MATRIX_OOP_H_
@@ -0,0 +1,352 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_matrix_view.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Methods of the non-owning matrix views of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_matrix_view.h"
+
+#include <algorithm>  // std::copy_n | std::min | std::max
+
+#include "s21_kernels.h"
+#include "s21_matrix_oop.h"
+#include "s21_transpose.h"
+
+namespace S21 {
+
+namespace {
+
+enum class Op { kAssign, kAdd, kSub };
+
+/**
+ * Returns the lowest and one past the highest address a view touches.
+ */
+template <class T>
+void Extent(const BasicConstMatrixView<T>& view, const T*& begin,
+            const T*& end) noexcept {
+  const std::ptrdiff_t last_row = (view.GetRows() - 1) * view.GetRowStride();
+  const std::ptrdiff_t last_col = (view.GetCols() - 1) * view.GetColStride();
+  begin = view.data() + std::min<std::ptrdiff_t>(last_row, 0) +
+          std::min<std::ptrdiff_t>(last_col, 0);
+  end = view.data() + std::max<std::ptrdiff_t>(last_row, 0) +
+        std::max<std::ptrdiff_t>(last_col, 0) + 1;
+}
+
+template <class T>
+bool SameLayout(const BasicConstMatrixView<T>& a,
+                const BasicConstMatrixView<T>& b) noexcept {
+  return a.data() == b.data() && a.GetRowStride() == b.GetRowStride() &&
+         a.GetColStride() == b.GetColStride();
+}
+
+/**
+ * True when writing dst element by element could clobber src elements that
+ * are still to be read.
+ */
+template <class T>
+bool PartiallyOverlaps(const BasicConstMatrixView<T>& dst,
+                       const BasicConstMatrixView<T>& src) noexcept {
+  if (!dst.GetRows() || !dst.GetCols() || SameLayout(dst, src)) return false;
+  const T *dst_begin, *dst_end, *src_begin, *src_end;
+  Extent(dst, dst_begin, dst_end);
+  Extent(src, src_begin, src_end);
+  return dst_begin < src_end && src_begin < dst_end;
+}
+
+/**
+ * dst = src, dst += src or dst -= src through the SIMD kernels when rows are
+ * contiguous, element by element otherwise.
+ */
+template <class T>
+void Apply(const BasicMatrixView<T>& dst, const BasicConstMatrixView<T>& src,
+           Op op) {
+  const int rows = dst.GetRows(), cols = dst.GetCols();
+  if (!rows || !cols || (op == Op::kAssign && SameLayout(dst, src))) return;
+  if (PartiallyOverlaps(dst, src)) {
+    const BasicMatrix<T> copy(src);
+    Apply(dst, copy.View(), op);
+    return;
+  }
+
+  const internal::BasicKernelTable<T>& kernels = internal::Kernels<T>();
+  const std::ptrdiff_t dst_rs = dst.GetRowStride(), dst_cs = dst.GetColStride();
+  const std::ptrdiff_t src_rs = src.GetRowStride(), src_cs = src.GetColStride();
+  if (op == Op::kAssign && dst_cs == 1 && src_rs == 1) {
+    // A transposed window: transpose the underlying block
+    internal::Transpose(cols, rows, src.data(), src_cs, dst.data(), dst_rs);
+    return;
+  }
+  if (dst_cs == 1 && src_cs == 1) {
+    // Whole buffers at once when both are packed
+    const bool packed = dst_rs == cols && src_rs == cols;
+    const std::ptrdiff_t n = packed ? static_cast<std::ptrdiff_t>(rows) * cols
+                                    : cols;
+    for (int i = 0; i < (packed ? 1 : rows); ++i) {
+      const T* s = src.data() + i * src_rs;
+      T* d = dst.data() + i * dst_rs;
+      if (op == Op::kAssign) {
+        std::copy_n(s, n, d);
+      } else {
+        (op == Op::kAdd ? kernels.add : kernels.sub)(n, s, d);
+      }
+    }
+    return;
+  }
+  for (int i = 0; i < rows; ++i) {
+    const T* s = src.data() + i * src_rs;
+    T* d = dst.data() + i * dst_rs;
+    for (int j = 0; j < cols; ++j) {
+      T& out = d[j * dst_cs];
+      const T value = s[j * src_cs];
+      out = op == Op::kAssign ? value
+            : op == Op::kAdd  ? out + value
+                              : out - value;
+    }
+  }
+}
+
+}  // namespace
+
+/******************************************************************************
+ * CONSTRUCTORS
+ ******************************************************************************/
+
+template <class T>
+BasicConstMatrixView<T>::BasicConstMatrixView() noexcept
+    : data_(nullptr), rows_(0), cols_(0), row_stride_(0), col_stride_(1) {}
+
+/**
+ * Views rows x cols elements, element (i, j) being
+ * data[i * row_stride + j * col_stride].
+ */
+template <class T>
+BasicConstMatrixView<T>::BasicConstMatrixView(
+    const T* data, int rows, int cols, std::ptrdiff_t row_stride,
+    std::ptrdiff_t col_stride) noexcept
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      row_stride_(row_stride),
+      col_stride_(col_stride) {}
+
+template <class T>
+BasicMatrixView<T>::BasicMatrixView(T* data, int rows, int cols,
+                                    std::ptrdiff_t row_stride,
+                                    std::ptrdiff_t col_stride) noexcept
+    : BasicConstMatrixView<T>(data, rows, cols, row_stride, col_stride) {}
+
+/******************************************************************************
+ * SLICING
+ ******************************************************************************/
+
+/**
+ * Returns the element at the given indices.
+ *
+ * @throws std::out_of_range if the indices are outside the view
+ */
+template <class T>
+const T& BasicConstMatrixView<T>::operator()(int i, int j) const {
+  CheckIndex(i, j);
+  return At(i, j);
+}
+
+template <class T>
+T& BasicMatrixView<T>::operator()(int i, int j) const {
+  this->CheckIndex(i, j);
+  return At(i, j);
+}
+
+/**
+ * Views the rows x cols block starting at (row, col).
+ *
+ * @throws std::out_of_range if the block does not fit into the view
+ */
+template <class T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Block(int row, int col,
+                                                       int rows,
+                                                       int cols) const {
+  CheckBlock(row, col, rows, cols);
+  return BasicConstMatrixView(data_ + row * row_stride_ + col * col_stride_,
+                              rows, cols, row_stride_, col_stride_);
+}
+
+template <class T>
+BasicMatrixView<T> BasicMatrixView<T>::Block(int row, int col, int rows,
+                                             int cols) const {
+  this->CheckBlock(row, col, rows, cols);
+  return BasicMatrixView(
+      data() + row * this->row_stride_ + col * this->col_stride_, rows, cols,
+      this->row_stride_, this->col_stride_);
+}
+
+template <class T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Row(int i) const {
+  return Block(i, 0, 1, cols_);
+}
+
+template <class T>
+BasicMatrixView<T> BasicMatrixView<T>::Row(int i) const {
+  return Block(i, 0, 1, this->cols_);
+}
+
+template <class T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Col(int j) const {
+  return Block(0, j, rows_, 1);
+}
+
+template <class T>
+BasicMatrixView<T> BasicMatrixView<T>::Col(int j) const {
+  return Block(0, j, this->rows_, 1);
+}
+
+/**
+ * Views the same elements transposed, no element is moved.
+ */
+template <class T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Transpose() const noexcept {
+  return BasicConstMatrixView(data_, cols_, rows_, col_stride_, row_stride_);
+}
+
+template <class T>
+BasicMatrixView<T> BasicMatrixView<T>::Transpose() const noexcept {
+  return BasicMatrixView(data(), this->cols_, this->rows_, this->col_stride_,
+                         this->row_stride_);
+}
+
+/******************************************************************************
+ * MAIN METHODS
+ ******************************************************************************/
+
+template <class T>
+bool BasicConstMatrixView<T>::EqMatrix(
+    const BasicConstMatrixView& other) const noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  for (int i = 0; i < rows_; ++i) {
+    for (int j = 0; j < cols_; ++j) {
+      if (At(i, j) != other.At(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Calculates the determinant of the viewed elements.
+ *
+ * @throws std::invalid_argument if the view is not square
+ */
+template <class T>
+T BasicConstMatrixView<T>::Determinant() const {
+  return BasicMatrix<T>(*this).Determinant();
+}
+
+template <class T>
+BasicMatrix<T> BasicConstMatrixView<T>::CalcComplements() const {
+  return BasicMatrix<T>(*this).CalcComplements();
+}
+
+template <class T>
+BasicMatrix<T> BasicConstMatrixView<T>::InverseMatrix() const {
+  return BasicMatrix<T>(*this).InverseMatrix();
+}
+
+/**
+ * Copies other into the viewed elements.
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+template <class T>
+void BasicMatrixView<T>::Assign(const BasicConstMatrixView<T>& other) const {
+  if (this->rows_ != other.GetRows() || this->cols_ != other.GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Assign");
+  }
+  Apply<T>(*this, other, Op::kAssign);
+}
+
+/**
+ * Adds other to the viewed elements.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sum
+ */
+template <class T>
+void BasicMatrixView<T>::SumMatrix(
+    const BasicConstMatrixView<T>& other) const {
+  if (this->rows_ != other.GetRows() || this->cols_ != other.GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sum");
+  }
+  Apply<T>(*this, other, Op::kAdd);
+}
+
+/**
+ * Subtracts other from the viewed elements.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sub
+ */
+template <class T>
+void BasicMatrixView<T>::SubMatrix(
+    const BasicConstMatrixView<T>& other) const {
+  if (this->rows_ != other.GetRows() || this->cols_ != other.GetCols()) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sub");
+  }
+  Apply<T>(*this, other, Op::kSub);
+}
+
+template <class T>
+void BasicMatrixView<T>::MulNumber(const T num) const noexcept {
+  const auto scale = internal::Kernels<T>().scale;
+  for (int i = 0; i < this->rows_; ++i) {
+    T* row = data() + i * this->row_stride_;
+    if (this->col_stride_ == 1) {
+      scale(this->cols_, num, row);
+    } else {
+      for (int j = 0; j < this->cols_; ++j) {
+        row[j * this->col_stride_] *= num;
+      }
+    }
+  }
+}
+
+/******************************************************************************
+ * PRIVATE METHODS
+ ******************************************************************************/
+
+template <class T>
+void BasicConstMatrixView<T>::CheckIndex(int i, int j) const {
+  if (i < 0 || j < 0 || i >= rows_ || j >= cols_) {
+    throw std::out_of_range("Index outside the matrix");
+  }
+}
+
+template <class T>
+void BasicConstMatrixView<T>::CheckBlock(int row, int col, int rows,
+                                         int cols) const {
+  if (row < 0 || col < 0 || rows < 0 || cols < 0 || row > rows_ - rows ||
+      col > cols_ - cols) {
+    throw std::out_of_range("Block outside the matrix");
+  }
+}
+
+template class BasicConstMatrixView<float>;
+template class BasicConstMatrixView<double>;
+template class BasicConstMatrixView<long double>;
+template class BasicConstMatrixView<int>;
+template class BasicConstMatrixView<long long>;
+template class BasicConstMatrixView<std::complex<float>>;
+template class BasicConstMatrixView<std::complex<double>>;
+template class BasicMatrixView<float>;
+template class BasicMatrixView<double>;
+template class BasicMatrixView<long double>;
+template class BasicMatrixView<int>;
+template class BasicMatrixView<long long>;
+template class BasicMatrixView<std::complex<float>>;
+template class BasicMatrixView<std::complex<double>>;
+
+}  // namespace S21
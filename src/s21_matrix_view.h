@@ -0,0 +1,125 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_matrix_view.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the non-owning matrix views of the
+ * CPP1_s21_matrixplus project.
+ *
+ * @details A view is a pointer plus rows, cols and the distances between two
+ * rows and two columns. It addresses a block, a row, a column or a
+ * transposed window of a matrix without copying it, and must not outlive the
+ * matrix. S21ConstMatrixView only reads, S21MatrixView also writes; both
+ * are the double instances of BasicConstMatrixView and BasicMatrixView.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_MATRIX_VIEW_H_
+#define CPP1_S21_MATRIXPLUS_S21_MATRIX_VIEW_H_
+
+#include <complex>    // std::complex
+#include <cstddef>    // std::ptrdiff_t
+#include <stdexcept>  // out_of_range | invalid_argument
+
+namespace S21 {
+
+template <class T>
+class BasicMatrix;
+
+template <class T>
+class BasicConstMatrixView {
+ public:
+  using value_type = T;
+
+  BasicConstMatrixView() noexcept;
+  BasicConstMatrixView(const T* data, int rows, int cols,
+                       std::ptrdiff_t row_stride,
+                       std::ptrdiff_t col_stride = 1) noexcept;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  std::ptrdiff_t GetRowStride() const noexcept { return row_stride_; }
+  std::ptrdiff_t GetColStride() const noexcept { return col_stride_; }
+  const T* data() const noexcept { return data_; }
+
+  // Unchecked unless S21_MATRIX_DEBUG is defined
+  const T& At(int i, int j) const {
+#ifdef S21_MATRIX_DEBUG
+    CheckIndex(i, j);
+#endif
+    return data_[i * row_stride_ + j * col_stride_];
+  }
+  const T& operator()(int i, int j) const;
+
+  BasicConstMatrixView Block(int row, int col, int rows, int cols) const;
+  BasicConstMatrixView Row(int i) const;
+  BasicConstMatrixView Col(int j) const;
+  BasicConstMatrixView Transpose() const noexcept;
+
+  bool EqMatrix(const BasicConstMatrixView& other) const noexcept;
+  T Determinant() const;
+  BasicMatrix<T> CalcComplements() const;
+  BasicMatrix<T> InverseMatrix() const;
+
+ protected:
+  void CheckIndex(int i, int j) const;
+  void CheckBlock(int row, int col, int rows, int cols) const;
+
+  const T* data_;
+  int rows_, cols_;
+  std::ptrdiff_t row_stride_;  // elements between two row starts
+  std::ptrdiff_t col_stride_;  // elements between two neighbours in a row
+};
+
+template <class T>
+class BasicMatrixView : public BasicConstMatrixView<T> {
+ public:
+  BasicMatrixView() noexcept = default;
+  BasicMatrixView(T* data, int rows, int cols, std::ptrdiff_t row_stride,
+                  std::ptrdiff_t col_stride = 1) noexcept;
+
+  T* data() const noexcept { return const_cast<T*>(this->data_); }
+
+  T& At(int i, int j) const {
+    return const_cast<T&>(BasicConstMatrixView<T>::At(i, j));
+  }
+  T& operator()(int i, int j) const;
+
+  BasicMatrixView Block(int row, int col, int rows, int cols) const;
+  BasicMatrixView Row(int i) const;
+  BasicMatrixView Col(int j) const;
+  BasicMatrixView Transpose() const noexcept;
+
+  // Element-wise operations on the viewed elements
+  void Assign(const BasicConstMatrixView<T>& other) const;
+  void SumMatrix(const BasicConstMatrixView<T>& other) const;
+  void SubMatrix(const BasicConstMatrixView<T>& other) const;
+  void MulNumber(const T num) const noexcept;
+};
+
+using S21ConstMatrixView = BasicConstMatrixView<double>;
+using S21MatrixView = BasicMatrixView<double>;
+
+extern template class BasicConstMatrixView<float>;
+extern template class BasicConstMatrixView<double>;
+extern template class BasicConstMatrixView<long double>;
+extern template class BasicConstMatrixView<int>;
+extern template class BasicConstMatrixView<long long>;
+extern template class BasicConstMatrixView<std::complex<float>>;
+extern template class BasicConstMatrixView<std::complex<double>>;
+extern template class BasicMatrixView<float>;
+extern template class BasicMatrixView<double>;
+extern template class BasicMatrixView<long double>;
+extern template class BasicMatrixView<int>;
+extern template class BasicMatrixView<long long>;
+extern template class BasicMatrixView<std::complex<float>>;
+extern template class BasicMatrixView<std::complex<double>>;
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_MATRIX_VIEW_H_
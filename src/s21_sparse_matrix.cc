@@ -0,0 +1,640 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_sparse_matrix.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Methods of the CSR sparse matrix of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @details Row-wise operations split the rows into chunks of about equal
+ * non-zero counts, so that a few dense rows do not leave the other threads
+ * idle. Every chunk writes its own rows of the result, without locks.
+ * Sparse sums merge every row at an upper-bound offset first and close
+ * the gaps afterwards, so the rows need no separate counting pass.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_sparse_matrix.h"
+
+#include <algorithm>  // std::lower_bound | std::stable_sort | std::copy_n
+#include <cstddef>    // std::ptrdiff_t
+#include <numeric>    // std::partial_sum
+#include <stdexcept>  // invalid_argument | out_of_range
+#include <utility>    // std::move
+
+#include "s21_kernels.h"
+#include "s21_thread_pool.h"
+
+namespace S21 {
+
+namespace {
+
+// Below this many multiply-adds one thread beats scheduling row chunks
+constexpr long long kSparseParallelSize = 1LL << 16;
+// Chunks per thread, to even out the rows that take longer
+constexpr int kChunksPerThread = 4;
+
+/**
+ * Runs body(begin, end) over consecutive row ranges, on the thread pool once
+ * work multiply-adds pay for it. Chunk t starts at row first_row(t, chunks).
+ */
+template <class FirstRow, class Body>
+void ForRowChunks(int rows, long long work, const FirstRow& first_row,
+                  const Body& body) {
+  ThreadPool& pool = ThreadPool::Global();
+  if (work < kSparseParallelSize || pool.Size() < 2 || rows < 2) {
+    body(0, rows);
+    return;
+  }
+  const int chunks = std::min(rows, kChunksPerThread * pool.Size());
+  std::vector<int> bounds(chunks + 1, rows);
+  bounds[0] = 0;
+  for (int t = 1; t < chunks; ++t) {
+    bounds[t] = std::max(bounds[t - 1], first_row(t, chunks));
+  }
+  pool.ParallelFor(chunks, [&](int t) {
+    if (bounds[t] < bounds[t + 1]) body(bounds[t], bounds[t + 1]);
+  });
+}
+
+/**
+ * ForRowChunks with chunks of about equal non-zero counts.
+ */
+template <class Body>
+void ForBalancedRows(const std::vector<int>& row_ptr, long long work,
+                     const Body& body) {
+  const int rows = static_cast<int>(row_ptr.size()) - 1;
+  const long long non_zeros = row_ptr.back();
+  ForRowChunks(
+      rows, work,
+      [&](int t, int chunks) {
+        const int target = static_cast<int>(non_zeros * t / chunks);
+        return static_cast<int>(
+            std::lower_bound(row_ptr.begin(), row_ptr.end(), target) -
+            row_ptr.begin());
+      },
+      body);
+}
+
+/**
+ * ForRowChunks with chunks of equal row counts.
+ */
+template <class Body>
+void ForEvenRows(int rows, long long work, const Body& body) {
+  ForRowChunks(
+      rows, work,
+      [&](int t, int chunks) {
+        return static_cast<int>(static_cast<long long>(rows) * t / chunks);
+      },
+      body);
+}
+
+}  // namespace
+
+/******************************************************************************
+ * CONSTRUCTORS
+ ******************************************************************************/
+
+/**
+ * Creates an empty 0 x 0 matrix.
+ *
+ * @throws std::bad_alloc if the row offsets cannot be allocated
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix() : BasicSparseMatrix(0, 0) {}
+
+/**
+ * Creates a rows x cols matrix of zeros.
+ *
+ * @throws std::invalid_argument if rows or cols are less than zero
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  if (rows_ < 0 || cols_ < 0) {
+    throw std::invalid_argument(
+        "Matrix size must be great then or equal to zero");
+  }
+  row_ptr_.assign(rows_ + 1, 0);
+}
+
+/**
+ * Creates a matrix from (row, col, value) triplets in any order.
+ *
+ * @details Triplets with the same coordinates are summed in their input
+ * order; elements that come out exactly zero are not stored. Costs
+ * O(n log n) for n triplets.
+ *
+ * @throws std::invalid_argument if rows or cols are less than zero
+ * @throws std::out_of_range if a triplet lies outside the matrix
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix(
+    int rows, int cols, const std::vector<BasicTriplet<T>>& triplets)
+    : BasicSparseMatrix(rows, cols) {
+  for (const BasicTriplet<T>& triplet : triplets) {
+    if (triplet.row < 0 || triplet.row >= rows_ || triplet.col < 0 ||
+        triplet.col >= cols_) {
+      throw std::out_of_range("Index outside the matrix");
+    }
+    ++row_ptr_[triplet.row + 1];
+  }
+  std::partial_sum(row_ptr_.begin(), row_ptr_.end(), row_ptr_.begin());
+
+  // Bucket the triplets by row, then sort every row by column
+  std::vector<int> order(triplets.size());
+  std::vector<int> next(row_ptr_.begin(), row_ptr_.end() - 1);
+  for (int k = 0; k < static_cast<int>(triplets.size()); ++k) {
+    order[next[triplets[k].row]++] = k;
+  }
+  col_index_.reserve(triplets.size());
+  values_.reserve(triplets.size());
+  int begin = 0;
+  for (int i = 0; i < rows_; ++i) {
+    const int end = row_ptr_[i + 1];
+    std::stable_sort(order.begin() + begin, order.begin() + end,
+                     [&triplets](int a, int b) {
+                       return triplets[a].col < triplets[b].col;
+                     });
+    for (int p = begin; p < end;) {
+      const int col = triplets[order[p]].col;
+      T sum{};
+      for (; p < end && triplets[order[p]].col == col; ++p) {
+        sum += triplets[order[p]].value;
+      }
+      if (sum != T{}) {
+        col_index_.push_back(col);
+        values_.push_back(sum);
+      }
+    }
+    begin = end;
+    row_ptr_[i + 1] = static_cast<int>(col_index_.size());
+  }
+}
+
+/**
+ * Takes over ready CSR arrays. Explicitly stored zeros are kept.
+ *
+ * @param row_ptr rows + 1 non-decreasing offsets, from 0 to the non-zeros
+ * @param col_index column of every element, strictly ascending in a row
+ * @param values every element, as many as col_index
+ *
+ * @throws std::invalid_argument if the arrays do not describe a rows x cols
+ * matrix
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix(int rows, int cols,
+                                        std::vector<int> row_ptr,
+                                        std::vector<int> col_index,
+                                        std::vector<T> values)
+    : rows_(rows),
+      cols_(cols),
+      row_ptr_(std::move(row_ptr)),
+      col_index_(std::move(col_index)),
+      values_(std::move(values)) {
+  CheckArrays();
+}
+
+/**
+ * Converts compressed sparse column arrays, in O(non-zeros + rows + cols).
+ *
+ * @throws std::invalid_argument if the arrays are inconsistent
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix(const BasicCsc<T>& csc)
+    : BasicSparseMatrix(BasicSparseMatrix(csc.cols, csc.rows, csc.col_ptr,
+                                          csc.row_index, csc.values)
+                            .Transpose()) {}
+
+/**
+ * Stores the non-zero elements of a dense matrix.
+ *
+ * @throws std::bad_alloc if the arrays cannot be allocated
+ */
+template <class T>
+BasicSparseMatrix<T>::BasicSparseMatrix(const BasicMatrix<T>& dense)
+    : BasicSparseMatrix(dense.GetRows(), dense.GetCols()) {
+  for (int i = 0; i < rows_; ++i) {
+    const T* row =
+        dense.data() + static_cast<std::ptrdiff_t>(i) * dense.GetStride();
+    for (int j = 0; j < cols_; ++j) {
+      if (row[j] != T{}) {
+        col_index_.push_back(j);
+        values_.push_back(row[j]);
+      }
+    }
+    row_ptr_[i + 1] = static_cast<int>(col_index_.size());
+  }
+}
+
+/******************************************************************************
+ * ACCESSORS
+ ******************************************************************************/
+
+template <class T>
+int BasicSparseMatrix<T>::GetRows() const noexcept {
+  return rows_;
+}
+
+template <class T>
+int BasicSparseMatrix<T>::GetCols() const noexcept {
+  return cols_;
+}
+
+template <class T>
+int BasicSparseMatrix<T>::GetNonZeros() const noexcept {
+  return row_ptr_.back();
+}
+
+template <class T>
+const std::vector<int>& BasicSparseMatrix<T>::GetRowPtr() const noexcept {
+  return row_ptr_;
+}
+
+template <class T>
+const std::vector<int>& BasicSparseMatrix<T>::GetColIndex() const noexcept {
+  return col_index_;
+}
+
+template <class T>
+const std::vector<T>& BasicSparseMatrix<T>::GetValues() const noexcept {
+  return values_;
+}
+
+/**
+ * Returns the element at (i, j), zero if it is not stored. O(log(row
+ * non-zeros)).
+ *
+ * @throws std::out_of_range if (i, j) lies outside the matrix
+ */
+template <class T>
+T BasicSparseMatrix<T>::operator()(int i, int j) const {
+  if (i < 0 || i >= rows_ || j < 0 || j >= cols_) {
+    throw std::out_of_range("Index outside the matrix");
+  }
+  const auto first = col_index_.begin() + row_ptr_[i];
+  const auto last = col_index_.begin() + row_ptr_[i + 1];
+  const auto found = std::lower_bound(first, last, j);
+  if (found == last || *found != j) return T{};
+  return values_[found - col_index_.begin()];
+}
+
+/******************************************************************************
+ * CONVERSIONS
+ ******************************************************************************/
+
+/**
+ * Returns the dense rows x cols matrix.
+ *
+ * @throws std::bad_alloc if the matrix cannot be allocated
+ */
+template <class T>
+BasicMatrix<T> BasicSparseMatrix<T>::ToDense() const {
+  BasicMatrix<T> dense(rows_, cols_);
+  for (int i = 0; i < rows_; ++i) {
+    T* row = dense.data() + static_cast<std::ptrdiff_t>(i) * dense.GetStride();
+    for (int p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) {
+      row[col_index_[p]] = values_[p];
+    }
+  }
+  return dense;
+}
+
+/**
+ * Returns the same matrix as compressed sparse column arrays, which are the
+ * CSR arrays of the transpose.
+ */
+template <class T>
+BasicCsc<T> BasicSparseMatrix<T>::ToCsc() const {
+  BasicSparseMatrix transposed = Transpose();
+  BasicCsc<T> csc;
+  csc.rows = rows_;
+  csc.cols = cols_;
+  csc.col_ptr = std::move(transposed.row_ptr_);
+  csc.row_index = std::move(transposed.col_index_);
+  csc.values = std::move(transposed.values_);
+  return csc;
+}
+
+/******************************************************************************
+ * MAIN METHODS
+ ******************************************************************************/
+
+/**
+ * Adds another sparse matrix in O(non-zeros of both).
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sum
+ */
+template <class T>
+void BasicSparseMatrix<T>::SumMatrix(const BasicSparseMatrix& other) {
+  *this = *this + other;
+}
+
+/**
+ * Subtracts another sparse matrix in O(non-zeros of both).
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sub
+ */
+template <class T>
+void BasicSparseMatrix<T>::SubMatrix(const BasicSparseMatrix& other) {
+  *this = *this - other;
+}
+
+/**
+ * Multiplies every element by num; by zero the matrix becomes empty.
+ */
+template <class T>
+void BasicSparseMatrix<T>::MulNumber(const T num) {
+  if (num == T{}) {
+    row_ptr_.assign(rows_ + 1, 0);
+    col_index_.clear();
+    values_.clear();
+    return;
+  }
+  for (T& value : values_) {
+    value *= num;
+  }
+}
+
+/**
+ * Sparse matrix-vector product y = A * x in O(non-zeros).
+ *
+ * @param x vector of GetCols() elements
+ *
+ * @throws std::invalid_argument if the size of x is wrong
+ */
+template <class T>
+std::vector<T> BasicSparseMatrix<T>::MulVector(const std::vector<T>& x) const {
+  if (static_cast<int>(x.size()) != cols_) {
+    throw std::invalid_argument("Incorrect vector size for Multiplication");
+  }
+  std::vector<T> y(rows_);
+  ForBalancedRows(row_ptr_, GetNonZeros(), [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      T sum{};
+      for (int p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) {
+        sum += values_[p] * x[col_index_[p]];
+      }
+      y[i] = sum;
+    }
+  });
+  return y;
+}
+
+/**
+ * Sparse times dense product, this * dense, in O(non-zeros * dense cols).
+ *
+ * @details Row i of the result gathers the rows of dense picked by the
+ * non-zeros of row i with the axpy kernel, so the inner loop is contiguous
+ * and vectorized. The result uses the memory resource of dense.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for
+ * Multiplication
+ */
+template <class T>
+BasicMatrix<T> BasicSparseMatrix<T>::MulDense(
+    const BasicMatrix<T>& dense) const {
+  if (dense.GetRows() != cols_) {
+    throw std::invalid_argument(
+        "Incorrect matrix dimensions for Multiplication");
+  }
+  const int n = dense.GetCols();
+  BasicMatrix<T> result(rows_, n, dense.GetResource());
+  const auto axpy = internal::Kernels<T>().axpy;
+  const std::ptrdiff_t ldb = dense.GetStride();
+  const std::ptrdiff_t ldc = result.GetStride();
+  ForBalancedRows(row_ptr_, static_cast<long long>(GetNonZeros()) * n,
+                  [&](int begin, int end) {
+                    for (int i = begin; i < end; ++i) {
+                      T* c = result.data() + i * ldc;
+                      for (int p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) {
+                        axpy(n, values_[p], dense.data() + col_index_[p] * ldb,
+                             c);
+                      }
+                    }
+                  });
+  return result;
+}
+
+/**
+ * Dense times sparse product, dense * this, in O(dense rows * non-zeros).
+ *
+ * @details Every element dense(i, l) scatters row l of this matrix into row
+ * i of the result; zero elements of dense are skipped. The result uses the
+ * memory resource of dense.
+ *
+ * @throws std::invalid_argument Incorrect matrix dimensions for
+ * Multiplication
+ */
+template <class T>
+BasicMatrix<T> BasicSparseMatrix<T>::MulDenseLeft(
+    const BasicMatrix<T>& dense) const {
+  if (dense.GetCols() != rows_) {
+    throw std::invalid_argument(
+        "Incorrect matrix dimensions for Multiplication");
+  }
+  const int m = dense.GetRows();
+  BasicMatrix<T> result(m, cols_, dense.GetResource());
+  const std::ptrdiff_t lda = dense.GetStride();
+  const std::ptrdiff_t ldc = result.GetStride();
+  ForEvenRows(m, static_cast<long long>(m) * GetNonZeros(),
+              [&](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                  const T* a = dense.data() + i * lda;
+                  T* c = result.data() + i * ldc;
+                  for (int l = 0; l < rows_; ++l) {
+                    const T factor = a[l];
+                    if (factor == T{}) continue;
+                    for (int p = row_ptr_[l]; p < row_ptr_[l + 1]; ++p) {
+                      c[col_index_[p]] += factor * values_[p];
+                    }
+                  }
+                }
+              });
+  return result;
+}
+
+/**
+ * Returns the transposed matrix, by a counting sort of the elements on their
+ * columns, in O(non-zeros + rows + cols).
+ */
+template <class T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::Transpose() const {
+  BasicSparseMatrix result(cols_, rows_);
+  for (int col : col_index_) {
+    ++result.row_ptr_[col + 1];
+  }
+  std::partial_sum(result.row_ptr_.begin(), result.row_ptr_.end(),
+                   result.row_ptr_.begin());
+  result.col_index_.resize(col_index_.size());
+  result.values_.resize(values_.size());
+  std::vector<int> next(result.row_ptr_.begin(), result.row_ptr_.end() - 1);
+  for (int i = 0; i < rows_; ++i) {
+    for (int p = row_ptr_[i]; p < row_ptr_[i + 1]; ++p) {
+      const int q = next[col_index_[p]]++;
+      result.col_index_[q] = i;
+      result.values_[q] = values_[p];
+    }
+  }
+  return result;
+}
+
+/******************************************************************************
+ * OPERATORS
+ ******************************************************************************/
+
+/**
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sum
+ */
+template <class T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::operator+(
+    const BasicSparseMatrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sum");
+  }
+  return Merge(other, T(1));
+}
+
+/**
+ * @throws std::invalid_argument Incorrect matrix dimensions for Sub
+ */
+template <class T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::operator-(
+    const BasicSparseMatrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument("Incorrect matrix dimensions for Sub");
+  }
+  return Merge(other, T(-1));
+}
+
+template <class T>
+BasicSparseMatrix<T>& BasicSparseMatrix<T>::operator+=(
+    const BasicSparseMatrix& other) {
+  SumMatrix(other);
+  return *this;
+}
+
+template <class T>
+BasicSparseMatrix<T>& BasicSparseMatrix<T>::operator-=(
+    const BasicSparseMatrix& other) {
+  SubMatrix(other);
+  return *this;
+}
+
+/******************************************************************************
+ * SUPPORT FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * Returns this + sign * other for operands of the same size.
+ *
+ * @details Every result row is the merge of two column-sorted rows, written
+ * at the offset it would have if nothing merged or cancelled; the rows are
+ * then moved down over the gaps. The merge picks its operands with
+ * conditional moves instead of branches, which random column patterns
+ * would mispredict on every element.
+ */
+template <class T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::Merge(
+    const BasicSparseMatrix& other, T sign) const {
+  BasicSparseMatrix result(rows_, cols_);
+  const int bound = GetNonZeros() + other.GetNonZeros();
+  result.col_index_.resize(bound);
+  result.values_.resize(bound);
+  const int* a_col = col_index_.data();
+  const T* a_value = values_.data();
+  const int* b_col = other.col_index_.data();
+  const T* b_value = other.values_.data();
+  // Offsets of the result rows before compaction, also the prefix sums of
+  // the work per row that the chunks split evenly
+  std::vector<int> merged_ptr(rows_ + 1);
+  for (int i = 0; i <= rows_; ++i) {
+    merged_ptr[i] = row_ptr_[i] + other.row_ptr_[i];
+  }
+
+  ForBalancedRows(merged_ptr, bound, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      int p = row_ptr_[i];
+      int q = other.row_ptr_[i];
+      const int p_end = row_ptr_[i + 1];
+      const int q_end = other.row_ptr_[i + 1];
+      int* out_col = result.col_index_.data() + merged_ptr[i];
+      T* out_value = result.values_.data() + merged_ptr[i];
+      int count = 0;
+      while (p < p_end && q < q_end) {
+        const bool take_a = a_col[p] <= b_col[q];
+        const bool take_b = b_col[q] <= a_col[p];
+        const T value = (take_a ? a_value[p] : T{}) +
+                        (take_b ? sign * b_value[q] : T{});
+        out_col[count] = take_a ? a_col[p] : b_col[q];
+        out_value[count] = value;
+        count += value != T{};
+        p += take_a;
+        q += take_b;
+      }
+      for (; p < p_end; ++p, ++count) {
+        out_col[count] = a_col[p];
+        out_value[count] = a_value[p];
+      }
+      for (; q < q_end; ++q, ++count) {
+        out_col[count] = b_col[q];
+        out_value[count] = sign * b_value[q];
+      }
+      result.row_ptr_[i + 1] = count;
+    }
+  });
+
+  // Rows only move towards the front, so they are moved in order
+  int offset = 0;
+  for (int i = 0; i < rows_; ++i) {
+    const int from = merged_ptr[i];
+    const int count = result.row_ptr_[i + 1];
+    std::copy_n(result.col_index_.begin() + from, count,
+                result.col_index_.begin() + offset);
+    std::copy_n(result.values_.begin() + from, count,
+                result.values_.begin() + offset);
+    offset += count;
+    result.row_ptr_[i + 1] = offset;
+  }
+  result.col_index_.resize(offset);
+  result.values_.resize(offset);
+  return result;
+}
+
+/**
+ * Checks that the CSR arrays describe a rows_ x cols_ matrix.
+ *
+ * @throws std::invalid_argument if they do not
+ */
+template <class T>
+void BasicSparseMatrix<T>::CheckArrays() const {
+  bool valid = rows_ >= 0 && cols_ >= 0 &&
+               static_cast<int>(row_ptr_.size()) == rows_ + 1 &&
+               row_ptr_[0] == 0 && col_index_.size() == values_.size() &&
+               row_ptr_.back() == static_cast<int>(col_index_.size()) &&
+               std::is_sorted(row_ptr_.begin(), row_ptr_.end());
+  for (int i = 0; valid && i < rows_; ++i) {
+    for (int p = row_ptr_[i]; valid && p < row_ptr_[i + 1]; ++p) {
+      valid = col_index_[p] >= 0 && col_index_[p] < cols_ &&
+              (p == row_ptr_[i] || col_index_[p - 1] < col_index_[p]);
+    }
+  }
+  if (!valid) {
+    throw std::invalid_argument("Incorrect sparse matrix arrays");
+  }
+}
+
+template class BasicSparseMatrix<float>;
+template class BasicSparseMatrix<double>;
+template class BasicSparseMatrix<long double>;
+template class BasicSparseMatrix<int>;
+template class BasicSparseMatrix<long long>;
+template class BasicSparseMatrix<std::complex<float>>;
+template class BasicSparseMatrix<std::complex<double>>;
+
+}  // namespace S21
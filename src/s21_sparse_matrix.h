@@ -0,0 +1,151 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_sparse_matrix.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the sparse matrices of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @details A sparse matrix stores only its non-zero elements, in compressed
+ * sparse row (CSR) form, so memory and the cost of its operations grow with
+ * the number of non-zeros instead of rows * cols.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_SPARSE_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_S21_SPARSE_MATRIX_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace S21 {
+
+/**
+ * One element of a sparse matrix given by coordinates.
+ */
+template <class T>
+struct BasicTriplet {
+  int row;
+  int col;
+  T value;
+};
+
+/**
+ * Compressed sparse column arrays: the row indices and values of column j
+ * are at positions col_ptr[j] to col_ptr[j + 1] - 1, rows ascending.
+ */
+template <class T>
+struct BasicCsc {
+  int rows = 0;
+  int cols = 0;
+  std::vector<int> col_ptr;  // cols + 1 offsets
+  std::vector<int> row_index;
+  std::vector<T> values;
+};
+
+/**
+ * Sparse matrix in compressed sparse row (CSR) form.
+ *
+ * @details The column indices and values of row i are at positions
+ * row_ptr[i] to row_ptr[i + 1] - 1, columns strictly ascending. Products with
+ * dense matrices and vectors cost O(non-zeros * dense columns) and O(non-zeros)
+ * and, once large enough, run on the library thread pool with the rows split
+ * into chunks of about equal non-zero counts. Sums and conversions drop the
+ * elements that come out exactly zero. T is any element type of BasicMatrix;
+ * S21SparseMatrix is BasicSparseMatrix<double>. Sizes and non-zero counts
+ * are int, like the dimensions of BasicMatrix.
+ */
+template <class T>
+class BasicSparseMatrix {
+ public:
+  using value_type = T;
+
+  BasicSparseMatrix();
+  BasicSparseMatrix(int rows, int cols);
+  BasicSparseMatrix(int rows, int cols,
+                    const std::vector<BasicTriplet<T>>& triplets);
+  BasicSparseMatrix(int rows, int cols, std::vector<int> row_ptr,
+                    std::vector<int> col_index, std::vector<T> values);
+  explicit BasicSparseMatrix(const BasicCsc<T>& csc);
+  explicit BasicSparseMatrix(const BasicMatrix<T>& dense);
+
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  int GetNonZeros() const noexcept;
+  const std::vector<int>& GetRowPtr() const noexcept;
+  const std::vector<int>& GetColIndex() const noexcept;
+  const std::vector<T>& GetValues() const noexcept;
+  T operator()(int i, int j) const;
+
+  BasicMatrix<T> ToDense() const;
+  BasicCsc<T> ToCsc() const;
+
+  void SumMatrix(const BasicSparseMatrix& other);
+  void SubMatrix(const BasicSparseMatrix& other);
+  void MulNumber(const T num);
+  std::vector<T> MulVector(const std::vector<T>& x) const;
+  BasicMatrix<T> MulDense(const BasicMatrix<T>& dense) const;
+  BasicMatrix<T> MulDenseLeft(const BasicMatrix<T>& dense) const;
+  BasicSparseMatrix Transpose() const;
+
+  BasicSparseMatrix operator+(const BasicSparseMatrix& other) const;
+  BasicSparseMatrix operator-(const BasicSparseMatrix& other) const;
+  BasicSparseMatrix& operator+=(const BasicSparseMatrix& other);
+  BasicSparseMatrix& operator-=(const BasicSparseMatrix& other);
+
+ private:
+  BasicSparseMatrix Merge(const BasicSparseMatrix& other, T sign) const;
+  void CheckArrays() const;
+
+  int rows_;
+  int cols_;
+  std::vector<int> row_ptr_;  // rows_ + 1 offsets
+  std::vector<int> col_index_;
+  std::vector<T> values_;
+};
+
+/**
+ * Sparse times dense product, this * dense.
+ */
+template <class T>
+BasicMatrix<T> operator*(const BasicSparseMatrix<T>& sparse,
+                         const BasicMatrix<T>& dense) {
+  return sparse.MulDense(dense);
+}
+
+/**
+ * Dense times sparse product, dense * sparse.
+ */
+template <class T>
+BasicMatrix<T> operator*(const BasicMatrix<T>& dense,
+                         const BasicSparseMatrix<T>& sparse) {
+  return sparse.MulDenseLeft(dense);
+}
+
+template <class T>
+std::vector<T> operator*(const BasicSparseMatrix<T>& sparse,
+                         const std::vector<T>& x) {
+  return sparse.MulVector(x);
+}
+
+using S21Triplet = BasicTriplet<double>;
+using S21Csc = BasicCsc<double>;
+using S21SparseMatrix = BasicSparseMatrix<double>;
+
+extern template class BasicSparseMatrix<float>;
+extern template class BasicSparseMatrix<double>;
+extern template class BasicSparseMatrix<long double>;
+extern template class BasicSparseMatrix<int>;
+extern template class BasicSparseMatrix<long long>;
+extern template class BasicSparseMatrix<std::complex<float>>;
+extern template class BasicSparseMatrix<std::complex<double>>;
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_SPARSE_MATRIX_H_
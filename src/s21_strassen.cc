@@ -0,0 +1,359 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_strassen.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Strassen-Winograd multiplication of the CPP1_s21_matrixplus
+ * project.
+ *
+ * @details Every level splits the even part of A, B and C into quadrants
+ * and runs the Winograd schedule of Boyer, Dumas, Pernet and Zhou (2009),
+ * which needs only two temporaries and keeps the partial results in C. All
+ * levels share one workspace allocated up front, so a product allocates
+ * once, about 2/3 of C for square operands. Odd rows, columns and inner
+ * dimensions are peeled off and added by the blocked GEMM. The parallel
+ * variant keeps all seven sub-products of the top level alive at once and
+ * runs them as thread pool tasks.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_strassen.h"
+
+#include <algorithm>  // std::min | std::max | std::copy_n | std::fill_n
+#include <atomic>     // std::atomic
+#include <memory>     // std::unique_ptr
+#include <stdexcept>  // invalid_argument
+
+#include "s21_complex.h"
+#include "s21_gemm.h"
+#include "s21_kernels.h"
+#include "s21_thread_pool.h"
+
+namespace S21 {
+
+namespace {
+
+std::atomic<S21MulAlgorithm> global_algorithm{S21MulAlgorithm::kClassic};
+std::atomic<int> global_crossover{S21MulPolicy{}.crossover};
+std::atomic<bool> global_parallel{S21MulPolicy{}.parallel};
+
+void CheckCrossover(int crossover) {
+  if (crossover < 1) {
+    throw std::invalid_argument("Crossover size must be greater than zero");
+  }
+}
+
+}  // namespace
+
+/**
+ * Sets the policy of the products computed without one of their own: the
+ * multiplication operators, MulMatrix and everything built on them.
+ *
+ * @throws std::invalid_argument if the crossover size is less than one
+ */
+void SetMulPolicy(const S21MulPolicy& policy) {
+  CheckCrossover(policy.crossover);
+  global_algorithm.store(policy.algorithm, std::memory_order_relaxed);
+  global_crossover.store(policy.crossover, std::memory_order_relaxed);
+  global_parallel.store(policy.parallel, std::memory_order_relaxed);
+}
+
+S21MulPolicy GetMulPolicy() noexcept {
+  S21MulPolicy policy;
+  policy.algorithm = global_algorithm.load(std::memory_order_relaxed);
+  policy.crossover = global_crossover.load(std::memory_order_relaxed);
+  policy.parallel = global_parallel.load(std::memory_order_relaxed);
+  return policy;
+}
+
+namespace internal {
+
+namespace {
+
+bool Recurses(int m, int n, int k, int crossover) noexcept {
+  return std::min({m, n, k}) > crossover;
+}
+
+std::size_t Area(int rows, int cols) noexcept {
+  return static_cast<std::size_t>(rows) * cols;
+}
+
+/**
+ * Workspace of the sequential recursion: the two temporaries of this level
+ * plus the workspace its sub-products share.
+ */
+std::size_t SequentialSize(int m, int n, int k, int crossover) noexcept {
+  if (!Recurses(m, n, k, crossover)) return 0;
+  const int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  return Area(m2, std::max(k2, n2)) + Area(k2, n2) +
+         SequentialSize(m2, n2, k2, crossover);
+}
+
+/**
+ * Workspace of the parallel top level: four sums of A, four of B, three
+ * products and a sequential workspace for each of the seven sub-products.
+ */
+std::size_t ParallelSize(int m, int n, int k, int crossover) noexcept {
+  const int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  return 4 * Area(m2, k2) + 4 * Area(k2, n2) + 3 * Area(m2, n2) +
+         7 * SequentialSize(m2, n2, k2, crossover);
+}
+
+template <class T>
+void Zero(int rows, int cols, T* c, std::ptrdiff_t ldc) noexcept {
+  for (int i = 0; i < rows; ++i) {
+    std::fill_n(c + i * ldc, cols, T{});
+  }
+}
+
+/**
+ * C = A + B, or A - B when subtract is set, for rows x cols blocks. C may
+ * be A or B.
+ */
+template <class T>
+void Combine(int rows, int cols, const T* a, std::ptrdiff_t lda, const T* b,
+             std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc,
+             bool subtract) noexcept {
+  const BasicKernelTable<T>& kernels = Kernels<T>();
+  for (int i = 0; i < rows; ++i) {
+    const T* a_row = a + i * lda;
+    const T* b_row = b + i * ldb;
+    T* c_row = c + i * ldc;
+    if (c_row == b_row) {
+      if (subtract) kernels.scale(cols, T(-1), c_row);
+      kernels.add(cols, a_row, c_row);
+    } else {
+      if (c_row != a_row) std::copy_n(a_row, cols, c_row);
+      (subtract ? kernels.sub : kernels.add)(cols, b_row, c_row);
+    }
+  }
+}
+
+/**
+ * Adds the peeled last column of A times the last row of B to the even
+ * part of C and computes the last row and column of C, for odd sizes.
+ */
+template <class T>
+void Peel(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+          std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc) {
+  const int me = m / 2 * 2, ne = n / 2 * 2, ke = k / 2 * 2;
+  if (k > ke) {
+    Gemm(me, ne, 1, 1.0, a + ke, lda, b + ke * ldb, ldb, c, ldc);
+  }
+  if (n > ne) {
+    Zero(me, 1, c + ne, ldc);
+    Gemm(me, 1, k, 1.0, a, lda, b + ne, ldb, c + ne, ldc);
+  }
+  if (m > me) {
+    Zero(1, n, c + me * ldc, ldc);
+    Gemm(1, n, k, 1.0, a + me * lda, lda, b, ldb, c + me * ldc, ldc);
+  }
+}
+
+/**
+ * C = A * B with the two-temporary schedule; work holds
+ * SequentialSize(m, n, k, crossover) elements.
+ */
+template <class T>
+void Recurse(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+             std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc, int crossover,
+             T* work) {
+  if (!Recurses(m, n, k, crossover)) {
+    Zero(m, n, c, ldc);
+    Gemm(m, n, k, 1.0, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  const T *a11 = a, *a12 = a + k2, *a21 = a + m2 * lda, *a22 = a21 + k2;
+  const T *b11 = b, *b12 = b + n2, *b21 = b + k2 * ldb, *b22 = b21 + n2;
+  T *c11 = c, *c12 = c + n2, *c21 = c + m2 * ldc, *c22 = c21 + n2;
+  // x holds the sums of A, then P1; y holds the sums of B
+  T* x = work;
+  T* y = x + Area(m2, std::max(k2, n2));
+  T* next = y + Area(k2, n2);
+
+  Combine(m2, k2, a11, lda, a21, lda, x, k2, true);      // S3
+  Combine(k2, n2, b22, ldb, b12, ldb, y, n2, true);      // T3
+  Recurse(m2, n2, k2, x, k2, y, n2, c21, ldc, crossover, next);  // P7
+  Combine(m2, k2, a21, lda, a22, lda, x, k2, false);     // S1
+  Combine(k2, n2, b12, ldb, b11, ldb, y, n2, true);      // T1
+  Recurse(m2, n2, k2, x, k2, y, n2, c22, ldc, crossover, next);  // P5
+  Combine(k2, n2, b22, ldb, y, n2, y, n2, true);         // T2
+  Combine(m2, k2, x, k2, a11, lda, x, k2, true);         // S2
+  Recurse(m2, n2, k2, x, k2, y, n2, c12, ldc, crossover, next);  // P6
+  Combine(m2, k2, a12, lda, x, k2, x, k2, true);         // S4
+  Recurse(m2, n2, k2, x, k2, b22, ldb, c11, ldc, crossover, next);  // P3
+  Recurse(m2, n2, k2, a11, lda, b11, ldb, x, n2, crossover, next);  // P1
+  Combine(m2, n2, x, n2, c12, ldc, c12, ldc, false);     // U2 = P1 + P6
+  Combine(m2, n2, c12, ldc, c21, ldc, c21, ldc, false);  // U3 = U2 + P7
+  Combine(m2, n2, c12, ldc, c22, ldc, c12, ldc, false);  // U4 = U2 + P5
+  Combine(m2, n2, c21, ldc, c22, ldc, c22, ldc, false);  // U7 = U3 + P5
+  Combine(m2, n2, c12, ldc, c11, ldc, c12, ldc, false);  // U5 = U4 + P3
+  Combine(k2, n2, y, n2, b21, ldb, y, n2, true);         // T4
+  Recurse(m2, n2, k2, a22, lda, y, n2, c11, ldc, crossover, next);  // P4
+  Combine(m2, n2, c21, ldc, c11, ldc, c21, ldc, true);   // U6 = U3 - P4
+  Recurse(m2, n2, k2, a12, lda, b21, ldb, c11, ldc, crossover, next);  // P2
+  Combine(m2, n2, x, n2, c11, ldc, c11, ldc, false);     // U1 = P1 + P2
+  Peel(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+/**
+ * C = A * B with the seven sub-products of the top level running as
+ * concurrent tasks; work holds ParallelSize(m, n, k, crossover) elements.
+ */
+template <class T>
+void RecurseParallel(ThreadPool& pool, int m, int n, int k, const T* a,
+                     std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+                     std::ptrdiff_t ldc, int crossover, T* work) {
+  const int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  const T *a11 = a, *a12 = a + k2, *a21 = a + m2 * lda, *a22 = a21 + k2;
+  const T *b11 = b, *b12 = b + n2, *b21 = b + k2 * ldb, *b22 = b21 + n2;
+  T *c11 = c, *c12 = c + n2, *c21 = c + m2 * ldc, *c22 = c21 + n2;
+  T* s[4];
+  T* t[4];
+  for (int i = 0; i < 4; ++i) {
+    s[i] = work + i * Area(m2, k2);
+    t[i] = work + 4 * Area(m2, k2) + i * Area(k2, n2);
+  }
+  T* p1 = t[3] + Area(k2, n2);
+  T* p2 = p1 + Area(m2, n2);
+  T* p4 = p2 + Area(m2, n2);
+  T* next = p4 + Area(m2, n2);
+  const std::size_t next_size = SequentialSize(m2, n2, k2, crossover);
+
+  Combine(m2, k2, a21, lda, a22, lda, s[0], k2, false);  // S1
+  Combine(m2, k2, s[0], k2, a11, lda, s[1], k2, true);   // S2
+  Combine(m2, k2, a11, lda, a21, lda, s[2], k2, true);   // S3
+  Combine(m2, k2, a12, lda, s[1], k2, s[3], k2, true);   // S4
+  Combine(k2, n2, b12, ldb, b11, ldb, t[0], n2, true);   // T1
+  Combine(k2, n2, b22, ldb, t[0], n2, t[1], n2, true);   // T2
+  Combine(k2, n2, b22, ldb, b12, ldb, t[2], n2, true);   // T3
+  Combine(k2, n2, t[1], n2, b21, ldb, t[3], n2, true);   // T4
+
+  struct Product {
+    const T* a;
+    std::ptrdiff_t lda;
+    const T* b;
+    std::ptrdiff_t ldb;
+    T* c;
+    std::ptrdiff_t ldc;
+  };
+  const Product products[7] = {
+      {a11, lda, b11, ldb, p1, n2},       // P1
+      {a12, lda, b21, ldb, p2, n2},       // P2
+      {s[3], k2, b22, ldb, c11, ldc},     // P3
+      {a22, lda, t[3], n2, p4, n2},       // P4
+      {s[0], k2, t[0], n2, c22, ldc},     // P5
+      {s[1], k2, t[1], n2, c12, ldc},     // P6
+      {s[2], k2, t[2], n2, c21, ldc},     // P7
+  };
+  pool.ParallelFor(7, [&](int i) {
+    const Product& p = products[i];
+    Recurse(m2, n2, k2, p.a, p.lda, p.b, p.ldb, p.c, p.ldc, crossover,
+            next + i * next_size);
+  });
+
+  Combine(m2, n2, p1, n2, c12, ldc, c12, ldc, false);    // U2 = P1 + P6
+  Combine(m2, n2, c12, ldc, c21, ldc, c21, ldc, false);  // U3 = U2 + P7
+  Combine(m2, n2, c12, ldc, c22, ldc, c12, ldc, false);  // U4 = U2 + P5
+  Combine(m2, n2, c21, ldc, c22, ldc, c22, ldc, false);  // U7 = U3 + P5
+  Combine(m2, n2, c12, ldc, c11, ldc, c12, ldc, false);  // U5 = U4 + P3
+  Combine(m2, n2, c21, ldc, p4, n2, c21, ldc, true);     // U6 = U3 - P4
+  Combine(m2, n2, p1, n2, p2, n2, c11, ldc, false);      // U1 = P1 + P2
+  Peel(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+}  // namespace
+
+/**
+ * Computes C = A * B as the policy says.
+ *
+ * @details C must hold zeros: the classic and 3M products accumulate into
+ * it. kComplex3M computes real products classically.
+ *
+ * @throws std::invalid_argument if the crossover size is less than one
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+void Multiply(const S21MulPolicy& policy, int m, int n, int k, const T* a,
+              std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+              std::ptrdiff_t ldc) {
+  CheckCrossover(policy.crossover);
+  if constexpr (kIsComplex<T>) {
+    if (policy.algorithm == S21MulAlgorithm::kComplex3M) {
+      Gemm3M(m, n, k, a, lda, b, ldb, c, ldc);
+      return;
+    }
+  }
+  if (policy.algorithm == S21MulAlgorithm::kStrassen &&
+      Recurses(m, n, k, policy.crossover)) {
+    Strassen(m, n, k, a, lda, b, ldb, c, ldc, policy.crossover,
+             policy.parallel);
+  } else {
+    Gemm(m, n, k, 1.0, a, lda, b, ldb, c, ldc);
+  }
+}
+
+/**
+ * Computes C = A * B by Strassen-Winograd recursion down to the crossover
+ * size.
+ *
+ * @param m, n, k dimensions of the product, as in Gemm
+ * @param crossover largest dimension the blocked GEMM computes directly
+ * @param parallel whether the top-level sub-products run on the thread pool
+ *
+ * @throws std::bad_alloc if the workspace cannot be allocated
+ */
+template <class T>
+void Strassen(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+              std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc, int crossover,
+              bool parallel) {
+  ThreadPool* pool = nullptr;
+  if (parallel && Recurses(m, n, k, crossover)) {
+    pool = &ThreadPool::Global();
+    if (pool->Size() == 1) pool = nullptr;
+  }
+  const std::size_t size =
+      StrassenWorkspaceSize(m, n, k, crossover, pool != nullptr);
+  const std::unique_ptr<T[]> work(new T[size]);
+  if (pool) {
+    RecurseParallel(*pool, m, n, k, a, lda, b, ldb, c, ldc, crossover,
+                    work.get());
+  } else {
+    Recurse(m, n, k, a, lda, b, ldb, c, ldc, crossover, work.get());
+  }
+}
+
+/**
+ * Returns how many elements of workspace Strassen() allocates.
+ */
+std::size_t StrassenWorkspaceSize(int m, int n, int k, int crossover,
+                                  bool parallel) noexcept {
+  if (!Recurses(m, n, k, crossover)) return 0;
+  return parallel ? ParallelSize(m, n, k, crossover)
+                  : SequentialSize(m, n, k, crossover);
+}
+
+#define S21_INSTANTIATE_STRASSEN(T)                                       \
+  template void Multiply<T>(const S21MulPolicy&, int, int, int, const T*, \
+                            std::ptrdiff_t, const T*, std::ptrdiff_t, T*, \
+                            std::ptrdiff_t);                              \
+  template void Strassen<T>(int, int, int, const T*, std::ptrdiff_t,      \
+                            const T*, std::ptrdiff_t, T*, std::ptrdiff_t, \
+                            int, bool);
+
+S21_INSTANTIATE_STRASSEN(float)
+S21_INSTANTIATE_STRASSEN(double)
+S21_INSTANTIATE_STRASSEN(long double)
+S21_INSTANTIATE_STRASSEN(int)
+S21_INSTANTIATE_STRASSEN(long long)
+S21_INSTANTIATE_STRASSEN(std::complex<float>)
+S21_INSTANTIATE_STRASSEN(std::complex<double>)
+
+}  // namespace internal
+}  // namespace S21
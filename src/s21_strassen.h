@@ -0,0 +1,64 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_strassen.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the Strassen-Winograd multiplication of the
+ * CPP1_s21_matrixplus project and of the policy choosing it.
+ *
+ * @details Strassen-Winograd computes a product with 7 half-size products
+ * and 15 additions instead of 8 products, recursively, until the operands
+ * are no larger than the crossover size and the blocked GEMM takes over.
+ * That is O(n^2.81) instead of O(n^3) work, at the price of a workspace
+ * and of a slightly larger rounding error (see test/strassen_tests.cc), so
+ * the classic product stays the default.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_STRASSEN_H_
+#define CPP1_S21_MATRIXPLUS_S21_STRASSEN_H_
+
+#include <cstddef>  // std::size_t | std::ptrdiff_t
+
+namespace S21 {
+
+enum class S21MulAlgorithm {
+  kClassic,    // blocked GEMM only
+  kStrassen,   // Strassen-Winograd above the crossover size
+  kComplex3M,  // three real GEMMs per complex product, classic for real types
+};
+
+// How matrix products are computed, see SetMulPolicy()
+struct S21MulPolicy {
+  S21MulAlgorithm algorithm = S21MulAlgorithm::kClassic;
+  // Products with a dimension of at most this size go to the blocked GEMM
+  int crossover = 512;
+  // Compute the seven sub-products of the top level concurrently
+  bool parallel = true;
+};
+
+void SetMulPolicy(const S21MulPolicy& policy);
+S21MulPolicy GetMulPolicy() noexcept;
+
+namespace internal {
+
+template <class T>
+void Multiply(const S21MulPolicy& policy, int m, int n, int k, const T* a,
+              std::ptrdiff_t lda, const T* b, std::ptrdiff_t ldb, T* c,
+              std::ptrdiff_t ldc);
+template <class T>
+void Strassen(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+              std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc, int crossover,
+              bool parallel);
+std::size_t StrassenWorkspaceSize(int m, int n, int k, int crossover,
+                                  bool parallel) noexcept;
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_STRASSEN_H_
@@ -0,0 +1,249 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_thread_pool.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Work-stealing thread pool of the CPP1_s21_matrixplus project.
+ *
+ * @details Every worker owns a task deque: it pops its own tasks from the
+ * back and steals from the front of the other deques when it runs dry.
+ * Threads outside the pool share deque 0. A thread waiting for a
+ * ParallelFor keeps executing queued tasks, so nested loops cannot
+ * deadlock the pool.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_thread_pool.h"
+
+#include <chrono>     // std::chrono::microseconds
+#include <cstdlib>    // std::getenv | std::atoi
+#include <exception>  // std::exception_ptr
+#include <stdexcept>  // invalid_argument
+
+namespace S21 {
+
+namespace {
+
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local int tls_queue = 0;
+
+std::mutex global_mutex;
+std::unique_ptr<ThreadPool> global_pool;
+
+/**
+ * Reads the default pool size from S21_NUM_THREADS or the hardware.
+ */
+int DefaultNumThreads() noexcept {
+  if (const char* env = std::getenv("S21_NUM_THREADS")) {
+    const int threads = std::atoi(env);
+    if (threads > 0) return threads;
+  }
+  const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+  return hardware > 0 ? hardware : 1;
+}
+
+}  // namespace
+
+struct ThreadPool::Job {
+  const std::function<void(int)>* body;
+  std::atomic<int> pending;
+  std::mutex mutex;
+  std::condition_variable done;
+  std::exception_ptr error;
+};
+
+/******************************************************************************
+ * CONSTRUCTOR & DESTRUCTOR
+ ******************************************************************************/
+
+/**
+ * Starts a pool running on the calling thread plus threads - 1 workers.
+ *
+ * @param threads total number of threads executing tasks
+ *
+ * @throws std::invalid_argument if threads is less than one
+ */
+ThreadPool::ThreadPool(int threads) : queued_(0), stop_(false) {
+  if (threads < 1) {
+    throw std::invalid_argument("Thread count must be greater than zero");
+  }
+  for (int i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (int i = 1; i < threads; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+/******************************************************************************
+ * MAIN METHODS
+ ******************************************************************************/
+
+int ThreadPool::Size() const noexcept {
+  return static_cast<int>(queues_.size());
+}
+
+/**
+ * Runs body(0) ... body(count - 1) across the pool and waits for all of them.
+ *
+ * @param count number of iterations
+ * @param body iteration body, called concurrently
+ *
+ * @throws the first exception thrown by body
+ */
+void ThreadPool::ParallelFor(int count, const std::function<void(int)>& body) {
+  if (count <= 0) return;
+  if (count == 1 || workers_.empty()) {
+    for (int i = 0; i < count; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  Job job;
+  job.body = &body;
+  job.pending.store(count);
+
+  // Contiguous index ranges per deque, starting with the caller's own
+  const int queues = Size();
+  const int home = CurrentQueue();
+  for (int q = 0; q < queues; ++q) {
+    Queue& queue = *queues_[(home + q) % queues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    for (int i = q * count / queues; i < (q + 1) * count / queues; ++i) {
+      queue.tasks.push_back(Task{&job, i});
+    }
+  }
+  queued_.fetch_add(count);
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_all();
+
+  while (job.pending.load() > 0) {
+    if (TryRunOne(home)) continue;
+    std::unique_lock<std::mutex> lock(job.mutex);
+    job.done.wait_for(lock, std::chrono::microseconds(100),
+                      [&job] { return job.pending.load() == 0; });
+  }
+
+  // The last task signals under the job mutex; taking it here guarantees
+  // no task still touches the job when it goes out of scope.
+  std::lock_guard<std::mutex> lock(job.mutex);
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+/**
+ * Returns the library-wide pool, created on first use.
+ */
+ThreadPool& ThreadPool::Global() {
+  std::lock_guard<std::mutex> lock(global_mutex);
+  if (!global_pool) {
+    global_pool = std::make_unique<ThreadPool>(DefaultNumThreads());
+  }
+  return *global_pool;
+}
+
+/******************************************************************************
+ * PRIVATE METHODS
+ ******************************************************************************/
+
+void ThreadPool::WorkerLoop(int index) {
+  tls_pool = this;
+  tls_queue = index;
+  for (;;) {
+    if (TryRunOne(index)) continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+    if (stop_ && queued_.load() == 0) return;
+  }
+}
+
+bool ThreadPool::PopLocal(int index, Task& task) {
+  Queue& queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) return false;
+  task = queue.tasks.back();
+  queue.tasks.pop_back();
+  return true;
+}
+
+bool ThreadPool::Steal(int thief, Task& task) {
+  const int queues = Size();
+  for (int q = 1; q < queues; ++q) {
+    Queue& queue = *queues_[(thief + q) % queues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::TryRunOne(int index) {
+  Task task{nullptr, 0};
+  if (!PopLocal(index, task) && !Steal(index, task)) return false;
+  queued_.fetch_sub(1);
+  Run(task);
+  return true;
+}
+
+void ThreadPool::Run(const Task& task) {
+  Job& job = *task.job;
+  try {
+    (*job.body)(task.index);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (!job.error) job.error = std::current_exception();
+  }
+  std::lock_guard<std::mutex> lock(job.mutex);
+  if (job.pending.fetch_sub(1) == 1) job.done.notify_all();
+}
+
+int ThreadPool::CurrentQueue() const noexcept {
+  return tls_pool == this ? tls_queue : 0;
+}
+
+/******************************************************************************
+ * CONFIGURATION
+ ******************************************************************************/
+
+/**
+ * Resizes the library-wide pool. Must not run concurrently with matrix
+ * operations.
+ *
+ * @param threads total number of threads, 1 disables parallelism
+ *
+ * @throws std::invalid_argument if threads is less than one
+ */
+void SetNumThreads(int threads) {
+  if (threads < 1) {
+    throw std::invalid_argument("Thread count must be greater than zero");
+  }
+  std::lock_guard<std::mutex> lock(global_mutex);
+  global_pool.reset();
+  global_pool = std::make_unique<ThreadPool>(threads);
+}
+
+/**
+ * Returns the size of the library-wide pool.
+ */
+int GetNumThreads() { return ThreadPool::Global().Size(); }
+
+}  // namespace S21
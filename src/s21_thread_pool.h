@@ -0,0 +1,77 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_thread_pool.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the work-stealing thread pool used by the
+ * parallel kernels of the CPP1_s21_matrixplus project.
+ *
+ * @details The library-wide pool size defaults to the S21_NUM_THREADS
+ * environment variable, or to the number of hardware threads when it is
+ * unset, and can be changed with SetNumThreads().
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_THREAD_POOL_H_
+#define CPP1_S21_MATRIXPLUS_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace S21 {
+
+class ThreadPool {
+ public:
+  explicit ThreadPool(int threads);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool() noexcept;
+
+  int Size() const noexcept;
+  void ParallelFor(int count, const std::function<void(int)>& body);
+
+  static ThreadPool& Global();
+
+ private:
+  struct Job;
+  struct Task {
+    Job* job;
+    int index;
+  };
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void WorkerLoop(int index);
+  bool PopLocal(int index, Task& task);
+  bool Steal(int thief, Task& task);
+  bool TryRunOne(int index);
+  void Run(const Task& task);
+  int CurrentQueue() const noexcept;
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<int> queued_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_;
+};
+
+void SetNumThreads(int threads);
+int GetNumThreads();
+
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_THREAD_POOL_H_
@@ -0,0 +1,150 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_transpose.cc
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief Cache-blocked transposition of the CPP1_s21_matrixplus project.
+ *
+ * @details Out of place, the matrix is halved recursively along its longer
+ * side until a tile fits in L1, so every level of the memory hierarchy sees
+ * both the reads and the writes of a tile at once (cache-oblivious). Tiles
+ * are transposed by the 4x4/8x8 in-register shuffles of the SIMD kernels.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#include "s21_transpose.h"
+
+#include <algorithm>  // std::copy_n | std::swap
+#include <cstddef>    // std::size_t
+#include <vector>     // std::vector
+
+#include "s21_kernels.h"
+
+namespace S21 {
+namespace internal {
+
+namespace {
+
+/**
+ * Splits n roughly in half, on a multiple of 8 so that the SIMD kernels see
+ * whole 8x8 tiles.
+ */
+int Half(int n) noexcept {
+  const int half = (n / 2 + 7) & ~7;
+  return half < n ? half : n / 2;
+}
+
+template <class T>
+void TransposeRecursive(const BasicKernelTable<T>& kernels, int rows, int cols,
+                        const T* a, std::ptrdiff_t lda, T* b,
+                        std::ptrdiff_t ldb) {
+  if (rows <= kTransposeBlock && cols <= kTransposeBlock) {
+    kernels.transpose(rows, cols, a, lda, b, ldb);
+  } else if (rows >= cols) {
+    const int top = Half(rows);
+    TransposeRecursive(kernels, top, cols, a, lda, b, ldb);
+    TransposeRecursive(kernels, rows - top, cols, a + top * lda, lda, b + top,
+                       ldb);
+  } else {
+    const int left = Half(cols);
+    TransposeRecursive(kernels, rows, left, a, lda, b, ldb);
+    TransposeRecursive(kernels, rows, cols - left, a + left, lda,
+                       b + left * ldb, ldb);
+  }
+}
+
+template <class T>
+void CopyTile(int rows, int cols, const T* a, std::ptrdiff_t lda, T* b,
+              std::ptrdiff_t ldb) {
+  for (int i = 0; i < rows; ++i) {
+    std::copy_n(a + i * lda, cols, b + i * ldb);
+  }
+}
+
+}  // namespace
+
+/**
+ * b = a^T for a rows x cols block of a; a and b must not overlap.
+ */
+template <class T>
+void Transpose(int rows, int cols, const T* a, std::ptrdiff_t lda, T* b,
+               std::ptrdiff_t ldb) {
+  if (rows <= 0 || cols <= 0) return;
+  TransposeRecursive(Kernels<T>(), rows, cols, a, lda, b, ldb);
+}
+
+/**
+ * Transposes an n x n block in place.
+ *
+ * @details Tiles (I, J) and (J, I) are exchanged through an L1-sized buffer:
+ * one is transposed into the buffer, the other straight onto the first, and
+ * the buffer onto the second.
+ */
+template <class T>
+void TransposeSquareInPlace(int n, T* a, std::ptrdiff_t lda) {
+  constexpr int kB = kTransposeBlock;
+  const BasicKernelTable<T>& kernels = Kernels<T>();
+  T tile[kB * kB];
+  for (int bi = 0; bi < n; bi += kB) {
+    const int rows = std::min(kB, n - bi);
+    T* diagonal = a + bi * lda + bi;
+    kernels.transpose(rows, rows, diagonal, lda, tile, kB);
+    CopyTile(rows, rows, tile, kB, diagonal, lda);
+    for (int bj = bi + kB; bj < n; bj += kB) {
+      const int cols = std::min(kB, n - bj);
+      T* upper = a + bi * lda + bj;  // rows x cols
+      T* lower = a + bj * lda + bi;  // cols x rows
+      kernels.transpose(rows, cols, upper, lda, tile, kB);
+      kernels.transpose(cols, rows, lower, lda, upper, lda);
+      CopyTile(cols, rows, tile, kB, lower, lda);
+    }
+  }
+}
+
+/**
+ * Transposes a packed rows x cols matrix into a packed cols x rows one in
+ * the same buffer by following the cycles of the permutation.
+ *
+ * @details Element k = i * cols + j moves to j * rows + i. One bit per
+ * element marks what has already moved, so the extra memory is 1/64 of the
+ * matrix instead of a second copy; the price is a scattered access pattern.
+ */
+template <class T>
+void TransposePackedInPlace(int rows, int cols, T* a) {
+  const std::size_t size = static_cast<std::size_t>(rows) * cols;
+  if (rows <= 1 || cols <= 1) return;
+  std::vector<bool> moved(size, false);
+  for (std::size_t start = 1; start + 1 < size; ++start) {
+    if (moved[start]) continue;
+    T value = a[start];
+    std::size_t k = start;
+    do {
+      const std::size_t next = (k % cols) * rows + k / cols;
+      std::swap(value, a[next]);
+      moved[next] = true;
+      k = next;
+    } while (k != start);
+  }
+}
+
+#define S21_INSTANTIATE_TRANSPOSE(T)                                 \
+  template void Transpose<T>(int, int, const T*, std::ptrdiff_t, T*, \
+                             std::ptrdiff_t);                        \
+  template void TransposeSquareInPlace<T>(int, T*, std::ptrdiff_t);  \
+  template void TransposePackedInPlace<T>(int, int, T*);
+
+S21_INSTANTIATE_TRANSPOSE(float)
+S21_INSTANTIATE_TRANSPOSE(double)
+S21_INSTANTIATE_TRANSPOSE(long double)
+S21_INSTANTIATE_TRANSPOSE(int)
+S21_INSTANTIATE_TRANSPOSE(long long)
+S21_INSTANTIATE_TRANSPOSE(std::complex<float>)
+S21_INSTANTIATE_TRANSPOSE(std::complex<double>)
+
+}  // namespace internal
+}  // namespace S21
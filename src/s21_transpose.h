@@ -0,0 +1,39 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+/**
+ * @file s21_transpose.h
+ *
+ * @author Dmitrii Khramtsov (lonmouth@student.21-school.ru)
+ *
+ * @brief The header file of the cache-blocked transposition used by
+ * S21Matrix::Transpose and S21Matrix::TransposeInPlace.
+ *
+ * @date 2024-02-19
+ *
+ * @copyright School-21 (c) 2024
+ */
+
+#ifndef CPP1_S21_MATRIXPLUS_S21_TRANSPOSE_H_
+#define CPP1_S21_MATRIXPLUS_S21_TRANSPOSE_H_
+
+#include <cstddef>  // std::ptrdiff_t
+
+namespace S21 {
+namespace internal {
+
+// Tiles up to kTransposeBlock x kTransposeBlock go straight to the SIMD
+// kernel: one tile of the source and one of the destination fit in L1.
+constexpr int kTransposeBlock = 32;
+
+template <class T>
+void Transpose(int rows, int cols, const T* a, std::ptrdiff_t lda, T* b,
+               std::ptrdiff_t ldb);
+template <class T>
+void TransposeSquareInPlace(int n, T* a, std::ptrdiff_t lda);
+template <class T>
+void TransposePackedInPlace(int rows, int cols, T* a);
+
+}  // namespace internal
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_S21_TRANSPOSE_H_
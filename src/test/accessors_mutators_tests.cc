@@ -168,3 +168,125 @@ TEST(s21_mutator_tests, SetCols_InvalidInput_ThrowsOutOfRange) {
   S21::S21Matrix m1 = {{1.0, 1.0, 1.}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}};
   EXPECT_THROW(m1.SetCols(-1), std::out_of_range);
 }
+
+/**
+ * TEST for the unchecked accessors: At, RowPtr, RowSpan and data.
+ */
+TEST(s21_accessor_tests, unchecked_access) {
+  S21::S21Matrix m1 = {{1, 2, 3}, {4, 5, 6}};
+  const S21::S21Matrix& view = m1;
+  EXPECT_EQ(view.At(1, 2), 6);
+  m1.At(0, 1) = 7;
+  EXPECT_EQ(m1(0, 1), 7);
+
+  double* row = m1.RowPtr(1);
+  row[0] = -4;
+  EXPECT_EQ(view.RowPtr(1)[0], -4);
+  EXPECT_EQ(view.data() + view.GetStride(), view.RowPtr(1));
+
+  double sum = 0;
+  for (const double value : view.RowSpan(1)) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 7);
+  S21::S21Span<double> span = m1.RowSpan(0);
+  EXPECT_EQ(span.size(), 3);
+  span[2] = 9;
+  EXPECT_EQ(m1(0, 2), 9);
+}
+
+/**
+ * TEST for shrinking and growing within the capacity, which keeps the buffer
+ * and zeroes the elements that come back.
+ */
+TEST(s21_mutator_tests, resize_within_capacity) {
+  S21::S21Matrix m1(5, 6);
+  m1(4, 5) = 9;
+  m1(1, 1) = 3;
+  const double* buffer = m1.data();
+
+  m1.SetRows(2);
+  m1.SetCols(2);
+  EXPECT_EQ(m1.data(), buffer);
+  EXPECT_EQ(m1.GetRowCapacity(), 5);
+  EXPECT_EQ(m1.GetColCapacity(), 6);
+
+  m1.SetRows(5);
+  m1.SetCols(6);
+  EXPECT_EQ(m1.data(), buffer);
+  EXPECT_EQ(m1(1, 1), 3);
+  EXPECT_EQ(m1(4, 5), 0);
+  EXPECT_EQ(m1(1, 4), 0);
+}
+
+/**
+ * TEST for appending rows: few reallocations, values kept, exact buffer
+ * after ShrinkToFit.
+ */
+TEST(s21_mutator_tests, append_row) {
+  S21::S21Matrix m1;
+  std::vector<double> row(7);
+  int reallocations = 0;
+  const double* buffer = m1.data();
+  for (int i = 0; i < 1000; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      row[j] = i * 10 + j;
+    }
+    m1.AppendRow(S21::S21Span<const double>(row.data(), 7));
+    if (m1.data() != buffer) {
+      buffer = m1.data();
+      ++reallocations;
+    }
+  }
+  EXPECT_EQ(m1.GetRows(), 1000);
+  EXPECT_EQ(m1.GetCols(), 7);
+  EXPECT_LE(reallocations, 12);
+  EXPECT_GE(m1.GetRowCapacity(), 1000);
+
+  m1.ShrinkToFit();
+  EXPECT_EQ(m1.GetRowCapacity(), 1000);
+  EXPECT_EQ(m1.GetStride(), 7);
+  for (int i = 0; i < 1000; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      EXPECT_EQ(m1(i, j), i * 10 + j);
+    }
+  }
+}
+
+/**
+ * TEST for appending a row of the matrix itself and a row of the wrong size.
+ */
+TEST(s21_mutator_tests, append_own_row) {
+  S21::S21Matrix m1 = {{1, 2}, {3, 4}};
+  for (int i = 0; i < 20; ++i) {
+    m1.AppendRow(m1.RowSpan(i % 2));
+  }
+  EXPECT_EQ(m1.GetRows(), 22);
+  EXPECT_EQ(m1(20, 1), 2);
+  EXPECT_EQ(m1(21, 0), 3);
+
+  std::vector<double> row(3);
+  EXPECT_THROW(m1.AppendRow(S21::S21Span<const double>(row.data(), 3)),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for reserving capacity: the size and the results of the operations
+ * do not change.
+ */
+TEST(s21_mutator_tests, reserve) {
+  S21::S21Matrix m1 = {{2, 1, 0}, {1, 3, 1}, {0, 1, 4}};
+  const S21::S21Matrix packed = m1;
+  m1.Reserve(10, 6);
+  EXPECT_EQ(m1.GetRows(), 3);
+  EXPECT_EQ(m1.GetCols(), 3);
+  EXPECT_GE(m1.GetRowCapacity(), 10);
+  EXPECT_EQ(m1.GetColCapacity(), 6);
+  EXPECT_TRUE(m1 == packed);
+  EXPECT_EQ(m1.Determinant(), packed.Determinant());
+  EXPECT_TRUE(m1 * m1 == packed * packed);
+  EXPECT_TRUE(m1 + m1 * 2.0 == packed * 3.0);
+  EXPECT_TRUE(m1.Transpose() == packed.Transpose());
+
+  EXPECT_THROW(m1.Reserve(-1, 2), std::out_of_range);
+}
@@ -0,0 +1,203 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include "../s21_lu.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+using S21::test::Wave;
+
+}  // namespace
+
+/**
+ * TEST for float products through the packed engine against double.
+ */
+TEST(s21_basic_matrix_tests, float_product) {
+  const S21::S21Matrix a = Wave<double>(67, 150, 1.0);
+  const S21::S21Matrix b = Wave<double>(150, 45, 2.0);
+  const S21::BasicMatrix<float> a_float(a);
+  const S21::BasicMatrix<float> b_float(b);
+  const S21::S21Matrix expected =
+      S21::S21Matrix(a_float) * S21::S21Matrix(b_float);
+  S21::BasicMatrix<float> product = a_float * b_float;
+  ASSERT_EQ(product.GetRows(), 67);
+  ASSERT_EQ(product.GetCols(), 45);
+  for (int i = 0; i < 67; ++i) {
+    for (int j = 0; j < 45; ++j) {
+      EXPECT_NEAR(product(i, j), expected(i, j), 1e-4);
+    }
+  }
+}
+
+/**
+ * TEST for long double arithmetic and factorization.
+ */
+TEST(s21_basic_matrix_tests, long_double) {
+  const long double tiny = std::numeric_limits<long double>::epsilon();
+  S21::BasicMatrix<long double> matrix = {{1, 0}, {0, 1}};
+  matrix += S21::BasicMatrix<long double>{{tiny, 0}, {0, 0}};
+  EXPECT_GT(matrix(0, 0), 1.0L);
+  EXPECT_EQ(matrix.Determinant(), 1.0L + tiny);
+
+  // Tridiagonal (-1, 2, -1) of size 4, det = 5. The solutions and the
+  // inverse are checked below the epsilon of double.
+  const S21::BasicMatrix<long double> a = {
+      {2, -1, 0, 0}, {-1, 2, -1, 0}, {0, -1, 2, -1}, {0, 0, -1, 2}};
+  S21::BasicLU<long double> lu(a);
+  EXPECT_FALSE(lu.IsSingular());
+  EXPECT_NEAR(lu.Determinant(), 5.0L, 1e-17L);
+  const std::vector<long double> x = {1.0L / 3, -2.0L / 7, 0.1L, 5.0L / 9};
+  std::vector<long double> b(4, 0.0L);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      b[i] += a(i, j) * x[j];
+    }
+  }
+  const std::vector<long double> solution = lu.Solve(b);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(solution[i], x[i], 1e-17L);
+  }
+  const S21::BasicMatrix<long double> identity = a * lu.Inverse();
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_NEAR(identity(i, j), i == j ? 1.0L : 0.0L, 1e-17L);
+    }
+  }
+}
+
+/**
+ * TEST for inverting well-conditioned matrices with small elements, whose
+ * determinants are far below the epsilon of float.
+ */
+TEST(s21_basic_matrix_tests, small_scale_inverse) {
+  for (int n : {2, 4, 9}) {
+    S21::BasicMatrix<float> matrix(n, n);
+    S21::BasicMatrix<std::complex<float>> complex_matrix(n, n);
+    for (int i = 0; i < n; ++i) {
+      matrix(i, i) = 0.01f;
+      complex_matrix(i, i) = {0.0f, 0.01f};
+    }
+    const S21::BasicMatrix<float> inverse = matrix.InverseMatrix();
+    const S21::BasicMatrix<std::complex<float>> complex_inverse =
+        complex_matrix.InverseMatrix();
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        EXPECT_NEAR(inverse(i, j), i == j ? 100.0f : 0.0f, 1e-3f);
+        EXPECT_NEAR(std::abs(complex_inverse(i, j) -
+                             std::complex<float>(0.0f, i == j ? -100.0f : 0)),
+                    0.0f, 1e-3f);
+      }
+    }
+  }
+  S21::BasicMatrix<float> singular = {
+      {1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {5, 3, 2, 1}};
+  singular.MulNumber(0.01f);
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+}
+
+/**
+ * TEST for exact integer determinants, including the fraction-free
+ * elimination used past the closed formulas.
+ */
+TEST(s21_basic_matrix_tests, int_determinant) {
+  S21::BasicMatrix<int> small = {{2, -1, 0}, {4, 3, 1}, {-2, 5, 7}};
+  EXPECT_EQ(small.Determinant(), 2 * (21 - 5) + (28 + 2));
+  S21::BasicMatrix<int> matrix = {{0, 3, 1, 2, 5},
+                                  {4, 0, 2, 7, 1},
+                                  {1, 6, 0, 3, 2},
+                                  {2, 1, 5, 0, 4},
+                                  {7, 2, 3, 1, 0}};
+  const double expected = S21::S21Matrix(matrix).Determinant();
+  EXPECT_EQ(matrix.Determinant(), static_cast<int>(std::lround(expected)));
+  S21::BasicMatrix<long long> singular = {
+      {1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {5, 0, 5, 0}};
+  EXPECT_EQ(singular.Determinant(), 0);
+  EXPECT_THROW(S21::BasicMatrix<int>(2, 3).Determinant(),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for integer complements and the inverse of unimodular matrices.
+ */
+TEST(s21_basic_matrix_tests, int_inverse) {
+  S21::BasicMatrix<long long> matrix = {
+      {2, 3, 1, 0}, {1, 2, 1, 0}, {0, 0, 1, 1}, {0, 0, 2, 3}};
+  ASSERT_EQ(matrix.Determinant(), 1);
+  const S21::BasicMatrix<long long> complements = matrix.CalcComplements();
+  const S21::S21Matrix expected = S21::S21Matrix(matrix).CalcComplements();
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_EQ(complements(i, j), std::llround(expected(i, j)));
+    }
+  }
+  const S21::BasicMatrix<long long> inverse = matrix.InverseMatrix();
+  S21::BasicMatrix<long long> identity(4, 4);
+  for (int i = 0; i < 4; ++i) identity(i, i) = 1;
+  EXPECT_TRUE((matrix * inverse).EqMatrix(identity));
+
+  S21::BasicMatrix<int> twice = {{2, 0}, {0, 1}};
+  EXPECT_THROW(twice.InverseMatrix(), std::invalid_argument);
+  S21::BasicMatrix<int> singular = {{1, 2}, {2, 4}};
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+}
+
+/**
+ * TEST for the fraction-free complements of large and singular integer
+ * matrices against the floating-point ones.
+ */
+TEST(s21_basic_matrix_tests, int_complements_exact) {
+  // (I + S) * (I - S^T) for the shift S is unimodular with small entries
+  const int n = 80;
+  S21::BasicMatrix<long long> matrix(n, n);
+  for (int i = 0; i < n; ++i) {
+    matrix(i, i) = i ? 0 : 1;
+    if (i) matrix(i, i - 1) = 1;
+    if (i + 1 < n) matrix(i, i + 1) = -1;
+  }
+  const S21::BasicMatrix<long long> inverse = matrix.InverseMatrix();
+  S21::BasicMatrix<long long> identity(n, n);
+  for (int i = 0; i < n; ++i) identity(i, i) = 1;
+  EXPECT_TRUE((matrix * inverse).EqMatrix(identity));
+
+  // Rank 4 of 5: the last row is the sum of the first two
+  S21::BasicMatrix<long long> singular = {{3, -1, 4, 1, 5},
+                                          {9, 2, -6, 5, 3},
+                                          {5, 8, 9, -7, 9},
+                                          {3, 2, 3, 8, -4},
+                                          {12, 1, -2, 6, 8}};
+  const S21::BasicMatrix<long long> complements = singular.CalcComplements();
+  const S21::S21Matrix expected = S21::S21Matrix(singular).CalcComplements();
+  bool nonzero = false;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      EXPECT_EQ(complements(i, j), std::llround(expected(i, j)));
+      nonzero = nonzero || complements(i, j);
+    }
+  }
+  EXPECT_TRUE(nonzero);
+
+  // Rank 3 of 5: every 4x4 minor vanishes
+  for (int j = 0; j < 5; ++j) singular(3, j) = singular(0, j) - singular(1, j);
+  S21::BasicMatrix<long long> zero = singular.CalcComplements();
+  EXPECT_TRUE(zero.EqMatrix(S21::BasicMatrix<long long>(5, 5)));
+}
+
+/**
+ * TEST for the converting constructor.
+ */
+TEST(s21_basic_matrix_tests, conversion) {
+  const S21::S21Matrix matrix = {{1.75, -2.25}, {3.5, 1e10}};
+  const S21::BasicMatrix<int> truncated(S21::S21Matrix{{1.75, -2.25}});
+  EXPECT_EQ(truncated(0, 0), 1);
+  EXPECT_EQ(truncated(0, 1), -2);
+  const S21::BasicMatrix<float> narrowed(matrix);
+  EXPECT_EQ(narrowed(0, 0), 1.75f);
+  EXPECT_EQ(narrowed(1, 1), 1e10f);
+  const S21::S21Matrix widened(narrowed);
+  EXPECT_EQ(widened(0, 1), -2.25);
+}
@@ -0,0 +1,132 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <thread>
+
+#include "../s21_buffer_pool.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+/**
+ * Enables the pool for one test and restores the defaults afterwards.
+ */
+class PoolScope {
+ public:
+  PoolScope() : was_enabled_(S21::IsBufferPoolEnabled()) {
+    S21::TrimBufferPool();
+    S21::SetBufferPoolEnabled(true);
+  }
+  ~PoolScope() {
+    S21::SetBufferPoolEnabled(was_enabled_);
+    S21::SetBufferPoolCap(std::size_t{64} << 20);
+    S21::TrimBufferPool();
+  }
+
+ private:
+  bool was_enabled_;
+};
+
+double Workload(int n) {
+  S21::S21Matrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    a(i, i) = 2.0;
+    a(i, (i + 1) % n) = 1.0;
+  }
+  S21::S21Matrix product = a * a;
+  return product.Determinant() + a.InverseMatrix()(0, 0);
+}
+
+}  // namespace
+
+/**
+ * TEST for a steady workload reusing retained buffers only.
+ */
+TEST(s21_buffer_pool_tests, steady_state_hits) {
+  PoolScope scope;
+  const double expected = Workload(40);
+  const S21::S21BufferPoolStats warm = S21::GetBufferPoolStats();
+  EXPECT_GT(warm.misses, 0u);
+  EXPECT_GT(warm.bytes_retained, 0u);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(Workload(40), expected);
+  }
+  const S21::S21BufferPoolStats steady = S21::GetBufferPoolStats();
+  EXPECT_EQ(steady.misses, warm.misses);
+  EXPECT_GT(steady.hits, warm.hits);
+  EXPECT_EQ(steady.bytes_retained, warm.bytes_retained);
+
+  S21::TrimBufferPool();
+  EXPECT_EQ(S21::GetBufferPoolStats().bytes_retained, 0u);
+  EXPECT_EQ(S21::GetBufferPoolStats().blocks_retained, 0u);
+}
+
+/**
+ * TEST for the cap on the retained bytes and for the pool being opt-in.
+ */
+TEST(s21_buffer_pool_tests, cap_and_opt_in) {
+  {
+    PoolScope scope;
+    S21::SetBufferPoolCap(1000);
+    { S21::S21Matrix a(10, 10), b(10, 10); }  // 800 bytes each
+    EXPECT_EQ(S21::GetBufferPoolStats().blocks_retained, 1u);
+    EXPECT_LE(S21::GetBufferPoolStats().bytes_retained, 1000u);
+
+    // Regrown and shrunk buffers come from and go back to their classes
+    const std::size_t hits = S21::GetBufferPoolStats().hits;
+    S21::S21Matrix c(10, 10);
+    c.SetRows(30);
+    c.SetRows(10);
+    c.ShrinkToFit();
+    EXPECT_EQ(S21::GetBufferPoolStats().hits, hits + 2);
+    EXPECT_EQ(c.GetResource(), S21::BufferPoolResource());
+  }
+
+  S21::SetBufferPoolEnabled(false);
+  const S21::S21BufferPoolStats before = S21::GetBufferPoolStats();
+  { S21::S21Matrix a(10, 10); }
+  EXPECT_EQ(S21::GetBufferPoolStats().misses, before.misses);
+  EXPECT_EQ(S21::GetBufferPoolStats().blocks_retained, 0u);
+}
+
+/**
+ * TEST for a buffer allocated on one thread and released on another.
+ */
+TEST(s21_buffer_pool_tests, cross_thread_release) {
+  PoolScope scope;
+  S21::S21Matrix matrix(20, 20);
+  matrix(19, 19) = 3;
+  std::thread worker([moved = std::move(matrix)]() mutable {
+    EXPECT_EQ(moved(19, 19), 3);
+    S21::S21Matrix sink = std::move(moved);
+  });
+  worker.join();
+  EXPECT_EQ(S21::GetBufferPoolStats().blocks_retained, 0u);
+
+  S21::S21Matrix again(20, 20);
+  EXPECT_EQ(again(19, 19), 0);
+}
+
+/**
+ * TEST for a matrix that took the pool before it was turned off: it neither
+ * reuses retained buffers nor counts hits and misses afterwards.
+ */
+TEST(s21_buffer_pool_tests, disabled_after_adoption) {
+  PoolScope scope;
+  S21::S21Matrix matrix(10, 10);
+  ASSERT_EQ(matrix.GetResource(), S21::BufferPoolResource());
+  { S21::S21Matrix retained(30, 10); }
+  ASSERT_EQ(S21::GetBufferPoolStats().blocks_retained, 1u);
+
+  // Turned off from another thread, so this thread keeps its retained block
+  std::thread([] { S21::SetBufferPoolEnabled(false); }).join();
+  const S21::S21BufferPoolStats before = S21::GetBufferPoolStats();
+  matrix(9, 9) = 5;
+  matrix.SetRows(30);
+  matrix.SetRows(40);
+  EXPECT_EQ(matrix(9, 9), 5);
+  const S21::S21BufferPoolStats after = S21::GetBufferPoolStats();
+  EXPECT_EQ(after.hits, before.hits);
+  EXPECT_EQ(after.misses, before.misses);
+  EXPECT_EQ(after.blocks_retained, 1u);
+}
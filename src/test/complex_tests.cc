@@ -0,0 +1,199 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "../s21_kernels.h"
+#include "../s21_lu.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+using Complex = std::complex<double>;
+using ComplexFloat = std::complex<float>;
+using S21::internal::BasicKernelTable;
+using S21::test::AvailableKernels;
+using S21::test::MaxDiff;
+using S21::test::Wave;
+
+/**
+ * Wave plus a dominant diagonal: the waves alone have rank 4 at most.
+ */
+S21::S21ComplexMatrix Invertible(int n, double phase) {
+  S21::S21ComplexMatrix matrix = Wave<Complex>(n, n, phase);
+  for (int i = 0; i < n; ++i) {
+    matrix(i, i) += Complex(n, 1);
+  }
+  return matrix;
+}
+
+template <class R>
+S21::BasicMatrix<std::complex<R>> NaiveProduct(
+    const S21::BasicMatrix<std::complex<R>>& a,
+    const S21::BasicMatrix<std::complex<R>>& b) {
+  S21::BasicMatrix<std::complex<R>> c(a.GetRows(), b.GetCols());
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < b.GetCols(); ++j) {
+      std::complex<double> sum = 0.0;
+      for (int k = 0; k < a.GetCols(); ++k) {
+        sum += std::complex<double>(a(i, k)) * std::complex<double>(b(k, j));
+      }
+      c(i, j) = std::complex<R>(sum);
+    }
+  }
+  return c;
+}
+
+S21::S21MulPolicy ThreeM() {
+  S21::S21MulPolicy policy;
+  policy.algorithm = S21::S21MulAlgorithm::kComplex3M;
+  return policy;
+}
+
+}  // namespace
+
+/**
+ * TEST for complex products with edges in every dimension of the tiles.
+ */
+TEST(s21_complex_tests, product) {
+  const S21::S21ComplexMatrix a = Wave<Complex>(37, 53, 1.0);
+  const S21::S21ComplexMatrix b = Wave<Complex>(53, 29, 2.0);
+  const S21::S21ComplexMatrix c = a * b;
+  ASSERT_EQ(c.GetRows(), 37);
+  ASSERT_EQ(c.GetCols(), 29);
+  EXPECT_LT(MaxDiff(c, NaiveProduct(a, b)), 1e-12);
+
+  const S21::BasicMatrix<ComplexFloat> a_float = Wave<ComplexFloat>(40, 70, 3);
+  const S21::BasicMatrix<ComplexFloat> b_float = Wave<ComplexFloat>(70, 45, 4);
+  EXPECT_LT(MaxDiff(a_float * b_float, NaiveProduct(a_float, b_float)), 1e-4);
+}
+
+/**
+ * TEST for the 3M product: three real GEMMs give the same product.
+ */
+TEST(s21_complex_tests, product_3m) {
+  const S21::S21ComplexMatrix a = Wave<Complex>(131, 97, 0.5);
+  const S21::S21ComplexMatrix b = Wave<Complex>(97, 75, 1.5);
+  S21::S21ComplexMatrix c(a);
+  c.MulMatrix(b, ThreeM());
+  EXPECT_LT(MaxDiff(c, NaiveProduct(a, b)), 1e-12);
+
+  S21::BasicMatrix<ComplexFloat> c_float = Wave<ComplexFloat>(33, 64, 2.5);
+  const S21::BasicMatrix<ComplexFloat> b_float = Wave<ComplexFloat>(64, 17, 1);
+  const S21::BasicMatrix<ComplexFloat> expected =
+      NaiveProduct(c_float, b_float);
+  c_float.MulMatrix(b_float, ThreeM());
+  EXPECT_LT(MaxDiff(c_float, expected), 1e-4);
+
+  // Real element types ignore the method
+  S21::S21Matrix real = {{1, 2}, {3, 4}};
+  real.MulMatrix(S21::S21Matrix{{1, 0}, {0, 1}}, ThreeM());
+  EXPECT_EQ(real(1, 0), 3);
+}
+
+/**
+ * TEST for the conjugate transpose: (A B)^H = B^H A^H.
+ */
+TEST(s21_complex_tests, conjugate_transpose) {
+  const S21::S21ComplexMatrix a = Wave<Complex>(5, 7, 0.0);
+  const S21::S21ComplexMatrix b = Wave<Complex>(7, 3, 1.0);
+  const S21::S21ComplexMatrix h = a.ConjugateTranspose();
+  ASSERT_EQ(h.GetRows(), 7);
+  ASSERT_EQ(h.GetCols(), 5);
+  EXPECT_EQ(h(6, 2), std::conj(a(2, 6)));
+  EXPECT_LT(MaxDiff(S21::S21ComplexMatrix(a * b).ConjugateTranspose(),
+                    b.ConjugateTranspose() * h),
+            1e-14);
+  EXPECT_EQ(a.Transpose()(6, 2), a(2, 6));
+
+  const S21::S21Matrix real = {{1, 2, 3}};
+  EXPECT_TRUE(real.ConjugateTranspose() == real.Transpose());
+}
+
+/**
+ * TEST for determinants, complements and inverses of complex matrices,
+ * through the closed formulas and through LU.
+ */
+TEST(s21_complex_tests, determinant_inverse) {
+  const Complex i(0, 1);
+  S21::S21ComplexMatrix small = {{1.0 + i, 2.0}, {i, 3.0 - i}};
+  EXPECT_LT(std::abs(small.Determinant() - ((1.0 + i) * (3.0 - i) - 2.0 * i)),
+            1e-15);
+
+  S21::S21ComplexMatrix triangular = Wave<Complex>(8, 8, 0.3);
+  Complex expected = 1.0;
+  for (int r = 0; r < 8; ++r) {
+    for (int c = 0; c < r; ++c) triangular(r, c) = 0.0;
+    expected *= triangular(r, r);
+  }
+  EXPECT_LT(std::abs(triangular.Determinant() - expected), 1e-12);
+
+  for (int n : {3, 9}) {
+    const S21::S21ComplexMatrix a = Invertible(n, 0.7);
+    S21::S21ComplexMatrix identity(n, n);
+    for (int r = 0; r < n; ++r) identity(r, r) = 1.0;
+    EXPECT_LT(MaxDiff(S21::S21ComplexMatrix(a * a.InverseMatrix()), identity),
+              1e-10);
+    const S21::S21ComplexMatrix adjugate = a.CalcComplements().Transpose();
+    const Complex det = a.Determinant();
+    S21::S21ComplexMatrix scaled(identity);
+    scaled.MulNumber(det);
+    EXPECT_LT(MaxDiff(S21::S21ComplexMatrix(a * adjugate), scaled),
+              1e-13 * std::abs(det));
+  }
+  EXPECT_THROW(S21::S21ComplexMatrix(2, 2).InverseMatrix(),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for solving complex systems with S21ComplexLU.
+ */
+TEST(s21_complex_tests, lu_solve) {
+  const int n = 40;
+  const S21::S21ComplexMatrix a = Invertible(n, 1.2);
+  const S21::S21ComplexMatrix expected = Wave<Complex>(n, 3, 2.2);
+  const S21::S21ComplexLU lu(a);
+  EXPECT_LT(MaxDiff(lu.Solve(a * expected), expected), 1e-10);
+
+  std::vector<Complex> b(n);
+  for (int r = 0; r < n; ++r) b[r] = (a * expected)(r, 0);
+  const std::vector<Complex> x = lu.Solve(b);
+  for (int r = 0; r < n; ++r) {
+    EXPECT_LT(std::abs(x[r] - expected(r, 0)), 1e-10);
+  }
+  EXPECT_LT(std::abs(lu.Determinant() - a.Determinant()), 1e-9);
+}
+
+/**
+ * TEST for the complex kernels of every available instruction set.
+ */
+TEST(s21_complex_tests, kernels) {
+  const int n = 23;
+  const S21::S21ComplexMatrix x = Wave<Complex>(1, n, 0.1);
+  const S21::S21ComplexMatrix y0 = Wave<Complex>(1, n, 0.2);
+  const Complex alpha(0.5, -1.5);
+  for (const BasicKernelTable<Complex>* table : AvailableKernels<Complex>()) {
+    S21::S21ComplexMatrix y(y0);
+    table->add(n, x.data(), y.data());
+    table->sub(n, x.data(), y.data());
+    table->scale(n, alpha, y.data());
+    table->axpy(n, alpha, x.data(), y.data());
+    for (int j = 0; j < n; ++j) {
+      EXPECT_LT(std::abs(y(0, j) - alpha * (y0(0, j) + x(0, j))), 1e-14);
+    }
+
+    const S21::S21ComplexMatrix a = Wave<Complex>(11, 13, 0.3);
+    S21::S21ComplexMatrix t(13, 11);
+    table->transpose(11, 13, a.data(), 13, t.data(), 11);
+    EXPECT_TRUE(t == a.Transpose());
+
+    const S21::S21ComplexMatrix b = Wave<Complex>(13, 9, 0.4);
+    S21::S21ComplexMatrix c(11, 9);
+    S21::internal::GemmPacked(table->gemm, 11, 9, 13, alpha, a.data(), 13,
+                              b.data(), 9, c.data(), 9);
+    S21::S21ComplexMatrix expected = NaiveProduct(a, b);
+    expected.MulNumber(alpha);
+    EXPECT_LT(MaxDiff(c, expected), 1e-13);
+  }
+}
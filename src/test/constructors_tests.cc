@@ -174,3 +174,32 @@ TEST(S21MatrixTest, CopyConstructorZeroSize) {
   EXPECT_EQ(copy.GetRows(), original.GetRows());
   EXPECT_EQ(copy.GetCols(), original.GetCols());
 }
+
+/**
+ * TEST for moving matrices stored inline and on the heap.
+ */
+TEST(S21MatrixTest, MoveInlineAndHeap) {
+  S21::S21Matrix small = {{1, 2}, {3, 4}};
+  S21::S21Matrix large(5, 5);
+  large(4, 4) = 25;
+
+  S21::S21Matrix moved_small(std::move(small));
+  S21::S21Matrix moved_large(std::move(large));
+  EXPECT_EQ(small.GetRows(), 0);
+  EXPECT_EQ(large.GetCols(), 0);
+  EXPECT_EQ(moved_small(1, 0), 3);
+  EXPECT_EQ(moved_large(4, 4), 25);
+
+  moved_small = std::move(moved_large);
+  EXPECT_EQ(moved_small.GetRows(), 5);
+  EXPECT_EQ(moved_small(4, 4), 25);
+  moved_large = S21::S21Matrix{{7}};
+  EXPECT_EQ(moved_large(0, 0), 7);
+
+  moved_small.SetRows(2);
+  moved_small.SetCols(2);
+  moved_small(1, 1) = 4;
+  moved_small.SetCols(9);
+  EXPECT_EQ(moved_small(1, 1), 4);
+  EXPECT_EQ(moved_small(1, 8), 0);
+}
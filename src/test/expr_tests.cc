@@ -0,0 +1,174 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include "s21_matrix_test.h"
+
+/**
+ * TEST for a chain of element-wise operations evaluated in one pass.
+ */
+TEST(s21_expr_tests, chain) {
+  const S21::S21Matrix a = {{1, 2}, {3, 4}, {5, 6}};
+  const S21::S21Matrix b = {{6, 5}, {4, 3}, {2, 1}};
+  const S21::S21Matrix c = {{1, 1}, {2, 2}, {3, 3}};
+  S21::S21Matrix result = a + b - c * 2.0;
+  S21::S21Matrix expected = {{5, 5}, {3, 3}, {1, 1}};
+  EXPECT_TRUE(result == expected);
+
+  result = 0.5 * (a - b) + (c + c) * 0.25;
+  expected = {{-2, -1}, {0.5, 1.5}, {3, 4}};
+  EXPECT_TRUE(result == expected);
+}
+
+/**
+ * TEST for expressions reading the matrix they are assigned to.
+ */
+TEST(s21_expr_tests, aliasing) {
+  S21::S21Matrix a = {{1, 2}, {3, 4}};
+  const S21::S21Matrix b = {{1, 1}, {1, 1}};
+  a = a + b - a * 2.0;
+  S21::S21Matrix expected = {{0, -1}, {-2, -3}};
+  EXPECT_TRUE(a == expected);
+
+  a += a * 2.0;
+  a -= b + b;
+  expected = {{-2, -5}, {-8, -11}};
+  EXPECT_TRUE(a == expected);
+
+  S21::S21Matrix small = {{1}};
+  small = b * 3.0;
+  EXPECT_EQ(small.GetRows(), 2);
+  EXPECT_EQ(small(1, 1), 3);
+}
+
+/**
+ * TEST for matrix products inside element-wise chains.
+ */
+TEST(s21_expr_tests, products) {
+  const S21::S21Matrix a = {{1, 2}, {3, 4}};
+  const S21::S21Matrix b = {{0, 1}, {1, 0}};
+  S21::S21Matrix result = a * b + a;
+  S21::S21Matrix expected = {{3, 3}, {7, 7}};
+  EXPECT_TRUE(result == expected);
+
+  result = (a + b) * (b * 2.0);
+  expected = {{6, 2}, {8, 8}};
+  EXPECT_TRUE(result == expected);
+
+  result = b * (a - b);
+  expected = {{2, 4}, {1, 1}};
+  EXPECT_TRUE(result == expected);
+}
+
+/**
+ * TEST for dimension errors reported while the expression is built.
+ */
+TEST(s21_expr_tests, errors) {
+  const S21::S21Matrix a(2, 3);
+  const S21::S21Matrix b(3, 2);
+  S21::S21Matrix c(2, 2);
+  EXPECT_THROW(a + b, std::invalid_argument);
+  EXPECT_THROW(a * 2.0 - b, std::invalid_argument);
+  EXPECT_THROW(c += a * 2.0, std::invalid_argument);
+  EXPECT_THROW(c -= b + b, std::invalid_argument);
+  EXPECT_THROW((a + a) * (a + a), std::invalid_argument);
+}
+
+/**
+ * TEST for expressions and transposes reusing the buffer of a temporary.
+ */
+TEST(s21_expr_tests, reuse_temporaries) {
+  S21::S21Matrix a(5, 5), b(5, 5);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      a(i, j) = i * 5 + j;
+      b(i, j) = i == j;
+    }
+  }
+
+  S21::S21Matrix product = a * b;
+  const double* buffer = &product(0, 0);
+  S21::S21Matrix result = b * 2.0 + std::move(product) * 0.5;
+  EXPECT_EQ(&result(0, 0), buffer);
+  EXPECT_EQ(result(1, 1), 5);
+  EXPECT_EQ(result(1, 2), 3.5);
+
+  result = a * b - a;
+  EXPECT_EQ(result(4, 4), 0);
+
+  buffer = &result(0, 0);
+  S21::S21Matrix transposed = std::move(result).Transpose();
+  EXPECT_EQ(&transposed(0, 0), buffer);
+  transposed = (a + b).Transpose();
+  EXPECT_EQ(transposed(1, 0), 1);
+  EXPECT_EQ(transposed(0, 1), 5);
+  EXPECT_EQ(transposed(3, 3), 19);
+  EXPECT_EQ(S21::S21Matrix(2, 3).Transpose().GetRows(), 3);
+}
+
+/**
+ * TEST for the matrix interface available on expressions.
+ */
+TEST(s21_expr_tests, matrix_interface) {
+  const S21::S21Matrix a = {{2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+  const S21::S21Matrix zero(3, 3);
+  EXPECT_EQ((a + zero)(2, 1), -2);
+  EXPECT_EQ((a - zero).Determinant(), -1);
+  S21::S21Matrix expected = {{1, -1, 1}, {-38, 41, -34}, {27, -29, 24}};
+  EXPECT_TRUE((a * 1.0).InverseMatrix() == expected);
+  expected = a.CalcComplements();
+  EXPECT_TRUE((a + zero).CalcComplements() == expected);
+  EXPECT_THROW((a + zero)(3, 0), std::out_of_range);
+}
+
+/**
+ * TEST for the comparisons and main methods of S21Matrix called, unchanged,
+ * on the results of + and -.
+ */
+TEST(s21_expr_tests, baseline_calls) {
+  const S21::S21Matrix a = {{1, 2}, {3, 4}};
+  const S21::S21Matrix b = {{4, 3}, {2, 1}};
+  S21::S21Matrix c = {{5, 5}, {5, 5}};
+  EXPECT_TRUE((a + b) == c);
+  EXPECT_TRUE(c == a + b);
+  EXPECT_TRUE((a + b) == (b + a));
+  EXPECT_FALSE((a - b) == c);
+  EXPECT_TRUE((a + b).EqMatrix(c));
+  EXPECT_TRUE((a + b).EqMatrix(b + a));
+  EXPECT_FALSE((a - b).EqMatrix(c));
+
+  (a + b).SumMatrix(c);
+  (a - b).SubMatrix(c);
+  (a + b).MulNumber(2.0);
+  (a + b).MulMatrix(c);
+  EXPECT_TRUE(c == S21::S21Matrix({{5, 5}, {5, 5}}));
+
+  // The main methods return the matrix they changed
+  static_assert(
+      std::is_same_v<decltype((a + b).MulNumber(2.0)), S21::S21Matrix>);
+  EXPECT_TRUE((a + b).SumMatrix(c) == c * 2.0);
+  EXPECT_TRUE((a - b).SubMatrix(a) == b * -1.0);
+  EXPECT_TRUE((a + b).MulNumber(2.0) == c * 2.0);
+  EXPECT_TRUE((a + b).MulMatrix(c) == c * 10.0);
+  EXPECT_THROW((a + b).SumMatrix(S21::S21Matrix(3, 2)),
+               std::invalid_argument);
+  EXPECT_THROW((a - b).SubMatrix(S21::S21Matrix(3, 2)),
+               std::invalid_argument);
+  EXPECT_THROW((a + b).MulMatrix(S21::S21Matrix(3, 2)),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for auto expressions: temporaries are moved into the tree, Eval()
+ * gives the matrix.
+ */
+TEST(s21_expr_tests, auto_expressions) {
+  auto sum = S21::S21Matrix{{1, 2}, {3, 4}} + S21::S21Matrix{{4, 3}, {2, 1}};
+  auto scaled = S21::S21Matrix{{1, 1}, {1, 1}} * 2.0;
+  const S21::S21Matrix expected = {{5, 5}, {5, 5}};
+  EXPECT_TRUE(sum == expected);
+  EXPECT_TRUE(sum - scaled == S21::S21Matrix({{3, 3}, {3, 3}}));
+
+  const S21::S21Matrix a = {{1, 2}, {3, 4}};
+  auto evaluated = (a + a).Eval();
+  static_assert(std::is_same_v<decltype(evaluated), S21::S21Matrix>);
+  EXPECT_TRUE(evaluated == a * 2.0);
+}
@@ -0,0 +1,92 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include "../s21_fixed_matrix.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+constexpr S21::S21FixedMatrix<3, 3> kMatrix3 = {
+    {2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+
+// Everything below the constructor must fold at compile time
+static_assert(kMatrix3.Determinant() == -1);
+static_assert(kMatrix3.InverseMatrix() ==
+              S21::S21FixedMatrix<3, 3>{
+                  {1, -1, 1}, {-38, 41, -34}, {27, -29, 24}});
+static_assert((kMatrix3 * kMatrix3.InverseMatrix()).Get<1, 1>() == 1);
+
+}  // namespace
+
+/**
+ * TEST for the arithmetic of fixed-size matrices.
+ */
+TEST(s21_fixed_matrix_tests, arithmetic) {
+  S21::S21FixedMatrix<2, 3> a = {{1, 2, 3}, {4, 5, 6}};
+  const S21::S21FixedMatrix<2, 3> b = {{6, 5, 4}, {3, 2, 1}};
+  const S21::S21FixedMatrix<2, 3> sum = {{7, 7, 7}, {7, 7, 7}};
+  EXPECT_TRUE(a + b == sum);
+  EXPECT_TRUE(sum - b == a);
+  a *= 2.0;
+  EXPECT_EQ(a(1, 2), 12);
+  EXPECT_EQ((a.Get<0, 1>()), 4);
+  EXPECT_EQ(a.Transpose()(2, 1), 12);
+  EXPECT_THROW(a(2, 0), std::out_of_range);
+}
+
+/**
+ * TEST for the product of fixed-size matrices of different shapes.
+ */
+TEST(s21_fixed_matrix_tests, multiplication) {
+  const S21::S21FixedMatrix<3, 2> a = {{1, 4}, {2, 5}, {3, 6}};
+  const S21::S21FixedMatrix<2, 3> b = {{1, -1, 1}, {2, 3, 4}};
+  const S21::S21FixedMatrix<3, 3> expected = {
+      {9, 11, 17}, {12, 13, 22}, {15, 15, 27}};
+  const S21::S21FixedMatrix<3, 3> result = a * b;
+  EXPECT_TRUE(result == expected);
+
+  S21::S21FixedMatrix<3, 2> c = a;
+  c *= S21::S21FixedMatrix<2, 2>{{1, 0}, {0, 2}};
+  EXPECT_EQ(c(2, 1), 12);
+}
+
+/**
+ * TEST for the determinant and inverse of every closed-form size and the
+ * elimination above it.
+ */
+TEST(s21_fixed_matrix_tests, inverse) {
+  const S21::S21FixedMatrix<4, 4> m4 = {
+      {0, 2, 1, 4}, {1, 0, 3, 2}, {2, 1, 0, 1}, {4, 3, 2, 0}};
+  const S21::S21FixedMatrix<5, 5> m5 = {{2, 1, 0, 0, 3},
+                                        {1, 3, 1, 0, 0},
+                                        {0, 1, 4, 1, 0},
+                                        {0, 0, 1, 5, 1},
+                                        {3, 0, 0, 1, 6}};
+  EXPECT_NEAR(m4.Determinant(), m4.ToMatrix().Determinant(), 1e-12);
+  EXPECT_NEAR(m5.Determinant(), m5.ToMatrix().Determinant(), 1e-10);
+
+  const S21::S21FixedMatrix<4, 4> i4 = m4 * m4.InverseMatrix();
+  const S21::S21FixedMatrix<5, 5> i5 = m5 * m5.InverseMatrix();
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      if (i < 4 && j < 4) {
+        EXPECT_NEAR(i4(i, j), i == j, 1e-12);
+      }
+      EXPECT_NEAR(i5(i, j), i == j, 1e-12);
+    }
+  }
+
+  const S21::S21FixedMatrix<2, 2> singular = {{1, 2}, {2, 4}};
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+}
+
+/**
+ * TEST for conversions between fixed-size and dynamic matrices.
+ */
+TEST(s21_fixed_matrix_tests, conversion) {
+  const S21::S21Matrix dynamic = {{1, 2}, {3, 4}, {5, 6}};
+  const S21::S21FixedMatrix<3, 2> fixed(dynamic);
+  EXPECT_EQ(fixed(2, 0), 5);
+  EXPECT_TRUE(static_cast<S21::S21Matrix>(fixed) == dynamic);
+  EXPECT_THROW((S21::S21FixedMatrix<2, 3>(dynamic)), std::invalid_argument);
+  EXPECT_THROW((S21::S21FixedMatrix<2, 2>{{1, 2, 3}}), std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include "s21_matrix_test.h"
+
+namespace {
+
+/**
+ * Fills the matrix with deterministic values in [-1, 1).
+ */
+void FillMatrix(S21::S21Matrix& matrix, int seed) {
+  for (int i = 0; i < matrix.GetRows(); ++i) {
+    for (int j = 0; j < matrix.GetCols(); ++j) {
+      matrix(i, j) = ((i * 31 + j * 17 + seed * 7) % 23) / 11.5 - 1.0;
+    }
+  }
+}
+
+/**
+ * Compares the product a * b with the textbook triple loop.
+ */
+void ExpectNaiveProduct(const S21::S21Matrix& a, const S21::S21Matrix& b,
+                        const S21::S21Matrix& product) {
+  ASSERT_EQ(product.GetRows(), a.GetRows());
+  ASSERT_EQ(product.GetCols(), b.GetCols());
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < b.GetCols(); ++j) {
+      double expected = 0.0;
+      for (int k = 0; k < a.GetCols(); ++k) {
+        expected += a(i, k) * b(k, j);
+      }
+      EXPECT_NEAR(product(i, j), expected, 1e-9);
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * TEST for a product with edge tiles in every dimension.
+ */
+TEST(s21_gemm_tests, odd_sizes) {
+  S21::S21Matrix a(97, 131);
+  S21::S21Matrix b(131, 75);
+  FillMatrix(a, 1);
+  FillMatrix(b, 2);
+  ExpectNaiveProduct(a, b, a * b);
+}
+
+/**
+ * TEST for a product spanning several cache blocks of A and B.
+ */
+TEST(s21_gemm_tests, multiple_blocks) {
+  S21::S21Matrix a(203, 517);
+  S21::S21Matrix b(517, 130);
+  FillMatrix(a, 3);
+  FillMatrix(b, 4);
+  ExpectNaiveProduct(a, b, a * b);
+}
+
+/**
+ * TEST for MulMatrix with the matrix multiplied by itself.
+ */
+TEST(s21_gemm_tests, mul_matrix_self) {
+  S21::S21Matrix a(64, 64);
+  FillMatrix(a, 5);
+  S21::S21Matrix expected = a * a;
+  a.MulMatrix(a);
+  EXPECT_TRUE(a == expected);
+}
+
+/**
+ * TEST for a product with an empty inner dimension.
+ */
+TEST(s21_gemm_tests, empty_inner_dimension) {
+  S21::S21Matrix a(3, 0);
+  S21::S21Matrix b(0, 4);
+  S21::S21Matrix product = a * b;
+  EXPECT_EQ(product.GetRows(), 3);
+  EXPECT_EQ(product.GetCols(), 4);
+  EXPECT_EQ(product(2, 3), 0.0);
+}
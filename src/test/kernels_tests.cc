@@ -0,0 +1,113 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <vector>
+
+#include "../s21_kernels.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+using S21::internal::BasicKernelTable;
+using S21::internal::SimdLevel;
+using S21::test::AvailableKernels;
+
+template <class T>
+std::vector<T> Sequence(int n, T step) {
+  std::vector<T> values(n);
+  for (int i = 0; i < n; ++i) {
+    values[i] = (i % 13) * step - 1;
+  }
+  return values;
+}
+
+template <class T>
+class s21_kernels_tests : public testing::Test {};
+
+using ElementTypes = testing::Types<double, float>;
+TYPED_TEST_SUITE(s21_kernels_tests, ElementTypes);
+
+}  // namespace
+
+/**
+ * TEST for the element-wise kernels of every available instruction set.
+ */
+TYPED_TEST(s21_kernels_tests, elementwise) {
+  using T = TypeParam;
+  const int n = 37;
+  const std::vector<T> x = Sequence<T>(n, 0.25);
+  for (const BasicKernelTable<T>* table : AvailableKernels<T>()) {
+    std::vector<T> y = Sequence<T>(n, 0.5);
+    table->add(n, x.data(), y.data());
+    table->sub(n, x.data(), y.data());
+    table->scale(n, 2, y.data());
+    table->axpy(n, -0.5, x.data(), y.data());
+    const std::vector<T> start = Sequence<T>(n, 0.5);
+    for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(y[i], 2 * start[i] - T(0.5) * x[i]);
+    }
+  }
+}
+
+/**
+ * TEST for the transpose kernels with edges in both dimensions.
+ */
+TYPED_TEST(s21_kernels_tests, transpose) {
+  using T = TypeParam;
+  const int rows = 19;
+  const int cols = 23;
+  const std::vector<T> a = Sequence<T>(rows * cols, 1);
+  for (const BasicKernelTable<T>* table : AvailableKernels<T>()) {
+    std::vector<T> b(rows * cols, 0);
+    table->transpose(rows, cols, a.data(), cols, b.data(), rows);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        EXPECT_EQ(b[j * rows + i], a[i * cols + j]);
+      }
+    }
+  }
+}
+
+/**
+ * TEST for the GEMM micro-kernels through the packed engine. The operands
+ * are short binary fractions, so every sum is exact in float as well.
+ */
+TYPED_TEST(s21_kernels_tests, gemm_micro_kernels) {
+  using T = TypeParam;
+  const int m = 53;
+  const int n = 71;
+  const int k = 300;
+  const std::vector<T> a = Sequence<T>(m * k, 0.125);
+  const std::vector<T> b = Sequence<T>(k * n, 0.0625);
+  for (const BasicKernelTable<T>* table : AvailableKernels<T>()) {
+    std::vector<T> c(m * n, 1);
+    S21::internal::GemmPacked(table->gemm, m, n, k, 2, a.data(), k, b.data(),
+                              n, c.data(), n);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double expected = 0.0;
+        for (int l = 0; l < k; ++l) {
+          expected += a[i * k + l] * b[l * n + j];
+        }
+        EXPECT_NEAR(c[i * n + j], 1.0 + 2.0 * expected, 1e-9);
+      }
+    }
+  }
+}
+
+/**
+ * TEST for the wider float tiles: twice the doubles per register.
+ */
+TEST(s21_kernels_float_tests, tile_widths) {
+  for (SimdLevel level : {SimdLevel::kSse2, SimdLevel::kAvx2,
+                          SimdLevel::kAvx512}) {
+    const auto* doubles = S21::internal::KernelsFor<double>(level);
+    const auto* floats = S21::internal::KernelsFor<float>(level);
+    ASSERT_EQ(doubles == nullptr, floats == nullptr);
+    if (!floats) continue;
+    EXPECT_EQ(floats->gemm.mr, doubles->gemm.mr);
+    EXPECT_EQ(floats->gemm.nr, 2 * doubles->gemm.nr);
+    EXPECT_LE(floats->gemm.nr, S21::internal::kMaxNr);
+  }
+  EXPECT_EQ(S21::internal::KernelsFor<long double>(SimdLevel::kAvx2), nullptr);
+  EXPECT_EQ(S21::internal::Kernels<int>().level, SimdLevel::kScalar);
+}
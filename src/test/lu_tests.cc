@@ -0,0 +1,221 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_lu.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+/**
+ * Diagonally dominant n x n matrix, well conditioned for float.
+ */
+S21::S21Matrix Dominant(int n) {
+  S21::S21Matrix matrix = S21::test::Wave<double>(n, n);
+  for (int i = 0; i < n; ++i) {
+    matrix(i, i) += n;
+  }
+  return matrix;
+}
+
+}  // namespace
+
+/**
+ * TEST for the determinant of a factorized matrix.
+ */
+TEST(s21_lu_tests, determinant) {
+  S21::S21Matrix matrix = {{0, -1, 3}, {0, 1, -2}, {5, 4, 1}};
+  S21::S21LU lu(matrix);
+  EXPECT_EQ(lu.GetSize(), 3);
+  EXPECT_FALSE(lu.IsSingular());
+  EXPECT_DOUBLE_EQ(lu.Determinant(), -5);
+}
+
+/**
+ * TEST for solving a system with a single right-hand side.
+ */
+TEST(s21_lu_tests, solve_vector) {
+  S21::S21Matrix matrix = {
+      {0, 2, 1, 4}, {1, 0, 3, 2}, {2, 1, 0, 1}, {4, 3, 2, 0}};
+  const std::vector<double> expected = {1, -2, 3, 0.5};
+  std::vector<double> b(4, 0.0);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      b[i] += matrix(i, j) * expected[j];
+    }
+  }
+  S21::S21LU lu(matrix);
+  const std::vector<double> x = lu.Solve(b);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(x[i], expected[i], 1e-14);
+  }
+}
+
+/**
+ * TEST for solving a system with several right-hand sides.
+ */
+TEST(s21_lu_tests, solve_matrix) {
+  S21::S21Matrix matrix = {{4, -2, 1}, {3, 6, -4}, {2, 1, 8}};
+  S21::S21Matrix expected = {{1, 0, 2, -1}, {0, 1, 3, 2}, {-1, 2, 0, 1}};
+  S21::S21Matrix b = matrix * expected;
+  S21::S21LU lu(matrix);
+  S21::S21Matrix x = lu.Solve(b);
+  ASSERT_EQ(x.GetRows(), 3);
+  ASSERT_EQ(x.GetCols(), 4);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_NEAR(x(i, j), expected(i, j), 1e-14);
+    }
+  }
+}
+
+/**
+ * TEST for the inverse computed from the factors.
+ */
+TEST(s21_lu_tests, inverse) {
+  S21::S21Matrix matrix = {{2, -1, 0}, {-1, 2, -1}, {0, -1, 2}};
+  S21::S21Matrix identity = matrix * S21::S21LU(matrix).Inverse();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_NEAR(identity(i, j), i == j ? 1.0 : 0.0, 1e-15);
+    }
+  }
+}
+
+/**
+ * TEST for the errors of the factorization.
+ */
+TEST(s21_lu_tests, errors) {
+  EXPECT_THROW(S21::S21LU(S21::S21Matrix(2, 3)), std::invalid_argument);
+
+  S21::S21LU singular(S21::S21Matrix{{1, 2}, {2, 4}});
+  EXPECT_TRUE(singular.IsSingular());
+  EXPECT_EQ(singular.Determinant(), 0);
+  EXPECT_THROW(singular.Solve(std::vector<double>{1, 2}),
+               std::invalid_argument);
+  EXPECT_THROW(singular.Inverse(), std::invalid_argument);
+
+  S21::S21LU lu(S21::S21Matrix{{1, 2}, {3, 4}});
+  EXPECT_THROW(lu.Solve(std::vector<double>{1, 2, 3}), std::invalid_argument);
+  EXPECT_THROW(lu.Solve(S21::S21Matrix(3, 1)), std::invalid_argument);
+}
+
+/**
+ * TEST for a nearly singular matrix: the factorization and InverseMatrix
+ * reject it alike instead of returning meaningless huge values.
+ */
+TEST(s21_lu_tests, nearly_singular) {
+  for (double delta : {1e-17, 1e-15}) {
+    const S21::S21Matrix matrix = {{1, 2}, {2, 4 + delta}};
+    S21::S21LU lu(matrix);
+    EXPECT_TRUE(lu.IsSingular());
+    EXPECT_THROW(lu.Solve(std::vector<double>{1, 2}), std::invalid_argument);
+    EXPECT_THROW(lu.Solve(S21::S21Matrix(2, 1)), std::invalid_argument);
+    EXPECT_THROW(lu.Inverse(), std::invalid_argument);
+    EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+  }
+
+  // Last row a rounding away from the one above it
+  const S21::S21Matrix dominant = Dominant(6);
+  S21::S21Matrix nearly = dominant;
+  for (int j = 0; j < 6; ++j) {
+    nearly(5, j) = dominant(4, j) * (1 + 1e-16 * j);
+  }
+  EXPECT_FALSE(S21::S21LU(dominant).IsSingular());
+  EXPECT_TRUE(S21::S21LU(nearly).IsSingular());
+  EXPECT_THROW(nearly.InverseMatrix(), std::invalid_argument);
+}
+
+/**
+ * TEST for the float factorization refined to double accuracy.
+ */
+TEST(s21_lu_tests, mixed_solve_vector) {
+  const int n = 150;
+  const S21::S21Matrix matrix = Dominant(n);
+  std::vector<double> b(n);
+  for (int i = 0; i < n; ++i) {
+    b[i] = std::cos(i * 0.9);
+  }
+  S21::S21MixedLU mixed(matrix);
+  EXPECT_EQ(mixed.GetSize(), n);
+  EXPECT_TRUE(mixed.IsSinglePrecision());
+  S21::S21RefinementInfo info;
+  const std::vector<double> x = mixed.Solve(b, &info);
+  EXPECT_TRUE(info.converged);
+  EXPECT_GE(info.iterations, 1);
+  EXPECT_LE(info.iterations, 5);
+  const std::vector<double> expected = S21::S21LU(matrix).Solve(b);
+  for (int i = 0; i < n; ++i) {
+    EXPECT_NEAR(x[i], expected[i], 1e-15);
+  }
+}
+
+/**
+ * TEST for refinement of several right-hand sides through GEMM residuals.
+ */
+TEST(s21_lu_tests, mixed_solve_matrix) {
+  const int n = 120;
+  const S21::S21Matrix matrix = Dominant(n);
+  S21::S21Matrix expected(n, 3);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      expected(i, j) = std::cos(i * 0.9 + j);
+    }
+  }
+  S21::S21RefinementInfo info;
+  const S21::S21Matrix x = S21::S21MixedLU(matrix).Solve(matrix * expected,
+                                                         &info);
+  EXPECT_TRUE(info.converged);
+  ASSERT_EQ(x.GetRows(), n);
+  ASSERT_EQ(x.GetCols(), 3);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_NEAR(x(i, j), expected(i, j), 1e-14);
+    }
+  }
+}
+
+/**
+ * TEST for the double-precision fallback: a Hilbert matrix too ill
+ * conditioned for float, and one that overflows float.
+ */
+TEST(s21_lu_tests, mixed_fallback) {
+  const int n = 10;
+  S21::S21Matrix hilbert(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      hilbert(i, j) = 1.0 / (i + j + 1);
+    }
+  }
+  const std::vector<double> b(n, 1.0);
+  S21::S21MixedLU mixed(hilbert);
+  S21::S21RefinementInfo info;
+  const std::vector<double> x = mixed.Solve(b, &info);
+  EXPECT_FALSE(info.converged);
+  EXPECT_EQ(x, S21::S21LU(hilbert).Solve(b));
+
+  S21::S21Matrix huge = {{1e300, 2e300}, {3e300, -1e300}};
+  S21::S21MixedLU wide(huge);
+  EXPECT_FALSE(wide.IsSinglePrecision());
+  const std::vector<double> b_wide = {3e300, 2e300};
+  const std::vector<double> y = wide.Solve(b_wide, &info);
+  EXPECT_FALSE(info.converged);
+  EXPECT_EQ(info.iterations, 0);
+  EXPECT_NEAR(y[0], 1.0, 1e-15);
+  EXPECT_NEAR(y[1], 1.0, 1e-15);
+}
+
+/**
+ * TEST for the errors of the mixed-precision solver.
+ */
+TEST(s21_lu_tests, mixed_errors) {
+  EXPECT_THROW(S21::S21MixedLU(S21::S21Matrix(2, 3)), std::invalid_argument);
+  S21::S21MixedLU singular(S21::S21Matrix{{1, 2}, {2, 4}});
+  EXPECT_FALSE(singular.IsSinglePrecision());
+  EXPECT_THROW(singular.Solve(std::vector<double>{1, 2}),
+               std::invalid_argument);
+  S21::S21MixedLU mixed(S21::S21Matrix{{1, 2}, {3, 4}});
+  EXPECT_THROW(mixed.Solve(std::vector<double>{1}), std::invalid_argument);
+  EXPECT_THROW(mixed.Solve(S21::S21Matrix(3, 1)), std::invalid_argument);
+}
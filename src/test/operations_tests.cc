@@ -315,6 +315,54 @@ TEST(s21_operation_tests, transpose_4) {
   }
 }
 
+/**
+ * Test case for transposing matrices larger than one tile, with sizes that
+ * are not multiples of the tile, in place and out of place.
+ */
+TEST(s21_operation_tests, transpose_blocked) {
+  const int sizes[][2] = {{67, 131}, {70, 70}, {37, 53}, {1, 45}, {45, 1}};
+  for (const auto& size : sizes) {
+    const int rows = size[0], cols = size[1];
+    S21::S21Matrix origin_matrix(rows, cols);
+    for (int i = 0; i != rows; ++i) {
+      for (int j = 0; j != cols; ++j) {
+        origin_matrix(i, j) = i * 1000 + j;
+      }
+    }
+
+    S21::S21Matrix copied = origin_matrix.Transpose();
+    S21::S21Matrix in_place = origin_matrix;
+    in_place.TransposeInPlace();
+    S21::S21Matrix moved = S21::S21Matrix(origin_matrix).Transpose();
+    for (const S21::S21Matrix* result : {&copied, &in_place, &moved}) {
+      ASSERT_EQ(cols, result->GetRows());
+      ASSERT_EQ(rows, result->GetCols());
+      for (int i = 0; i != cols; ++i) {
+        for (int j = 0; j != rows; ++j) {
+          EXPECT_EQ(origin_matrix(j, i), (*result)(i, j));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Test case for transposing in place a matrix whose rows are padded.
+ */
+TEST(s21_operation_tests, transpose_in_place_padded) {
+  S21::S21Matrix origin_matrix = {{1, 2, 3}, {4, 5, 6}};
+  origin_matrix.SetCols(5);
+  origin_matrix.SetRows(7);
+  origin_matrix(6, 4) = 7;
+  S21::S21Matrix expected = origin_matrix.Transpose();
+  origin_matrix.TransposeInPlace();
+  EXPECT_EQ(5, origin_matrix.GetRows());
+  EXPECT_EQ(7, origin_matrix.GetCols());
+  EXPECT_TRUE(origin_matrix == expected);
+  EXPECT_EQ(6, origin_matrix(2, 1));
+  EXPECT_EQ(7, origin_matrix(4, 6));
+}
+
 /**
  * Test case for the determinant_1 function.
  *
@@ -614,3 +662,140 @@ TEST(inverse_matrix_tests, inverse_matrix_throw_zero_determinant) {
   S21::S21Matrix matrix = S21::S21Matrix(2, 2);
   EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
 }
+
+/**
+ * TEST for inverting a matrix larger than the adjugate path handles.
+ */
+TEST(inverse_matrix_tests, inverse_matrix_large) {
+  const int n = 40;
+  S21::S21Matrix matrix(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      matrix(i, j) = (i * 7 + j * 11) % 13 - 6.0 + (i == j ? 50.0 : 0.0);
+    }
+  }
+  S21::S21Matrix identity = matrix * matrix.InverseMatrix();
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      EXPECT_NEAR(identity(i, j), i == j ? 1.0 : 0.0, 1e-12);
+    }
+  }
+}
+
+/**
+ * TEST for inverting a 4x4 matrix that needs row pivoting.
+ */
+TEST(inverse_matrix_tests, inverse_matrix_pivoting) {
+  S21::S21Matrix matrix = {
+      {0, 2, 1, 4}, {1, 0, 3, 2}, {2, 1, 0, 1}, {4, 3, 2, 0}};
+  S21::S21Matrix identity = matrix.InverseMatrix() * matrix;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_NEAR(identity(i, j), i == j ? 1.0 : 0.0, 1e-14);
+    }
+  }
+}
+
+/**
+ * TEST for a singular 4x4 matrix on the factorization path.
+ */
+TEST(inverse_matrix_tests, inverse_matrix_throw_singular_large) {
+  S21::S21Matrix matrix = {
+      {1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {5, 3, 2, 1}};
+  EXPECT_THROW(matrix.InverseMatrix(), std::invalid_argument);
+}
+
+namespace {
+
+/**
+ * Computes the complements of a matrix directly from its minors.
+ */
+S21::S21Matrix BruteForceComplements(const S21::S21Matrix& matrix) {
+  const int n = matrix.GetRows();
+  S21::S21Matrix result(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      S21::S21Matrix minor(n - 1, n - 1);
+      for (int k = 0; k < n - 1; ++k) {
+        for (int l = 0; l < n - 1; ++l) {
+          minor(k, l) = matrix(k < i ? k : k + 1, l < j ? l : l + 1);
+        }
+      }
+      result(i, j) = minor.Determinant() * ((i + j) % 2 ? -1 : 1);
+    }
+  }
+  return result;
+}
+
+void ExpectComplementsNear(const S21::S21Matrix& matrix, double tolerance) {
+  S21::S21Matrix expected = BruteForceComplements(matrix);
+  S21::S21Matrix calcs = matrix.CalcComplements();
+  for (int i = 0; i < matrix.GetRows(); ++i) {
+    for (int j = 0; j < matrix.GetCols(); ++j) {
+      EXPECT_NEAR(expected(i, j), calcs(i, j), tolerance);
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * TEST for the complements of a non-singular 5x5 matrix.
+ */
+TEST(s21_operation_tests, calccomplements_non_singular_large) {
+  S21::S21Matrix origin_matrix = {{2, -1, 0, 3, 1},
+                                  {4, 1, -2, 0, 5},
+                                  {1, 3, 1, -1, 0},
+                                  {0, 2, 4, 1, -3},
+                                  {-2, 0, 1, 2, 1}};
+  ExpectComplementsNear(origin_matrix, 1e-9);
+}
+
+/**
+ * TEST for the complements of a 5x5 matrix of rank 4.
+ */
+TEST(s21_operation_tests, calccomplements_rank_deficient_by_one) {
+  S21::S21Matrix origin_matrix = {{1, 2, 0, 3, 1},
+                                  {0, 1, 4, 1, 2},
+                                  {2, 5, 4, 7, 4},
+                                  {3, 0, 1, 1, 0},
+                                  {1, 1, 1, 0, 2}};
+  ExpectComplementsNear(origin_matrix, 1e-9);
+}
+
+/**
+ * TEST for the complements of a 4x4 matrix of rank 2, which are all zero.
+ */
+TEST(s21_operation_tests, calccomplements_rank_deficient_by_two) {
+  S21::S21Matrix origin_matrix = {
+      {1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {1, 3, 3, 5}};
+  S21::S21Matrix calcs = origin_matrix.CalcComplements();
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_EQ(0, calcs(i, j));
+    }
+  }
+}
+
+/**
+ * TEST for the determinant of a matrix spanning several LU panels.
+ */
+TEST(s21_operation_tests, determinant_blocked) {
+  const int n = 150;
+  S21::S21Matrix origin_matrix(n, n);
+  for (int i = 0; i < n; ++i) {
+    origin_matrix(i, i) = 2;
+    if (i) origin_matrix(i, i - 1) = -1;
+    if (i + 1 < n) origin_matrix(i, i + 1) = -1;
+  }
+  EXPECT_NEAR(origin_matrix.Determinant(), n + 1, 1e-9);
+}
+
+/**
+ * TEST for the determinant of a matrix with a tiny leading pivot.
+ */
+TEST(s21_operation_tests, determinant_tiny_pivot) {
+  S21::S21Matrix origin_matrix = {
+      {1e-18, 1, 0, 0}, {1, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+  EXPECT_DOUBLE_EQ(origin_matrix.Determinant(), -1);
+}
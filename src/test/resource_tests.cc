@@ -0,0 +1,126 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <map>
+
+#include "s21_matrix_test.h"
+
+namespace {
+
+/**
+ * Forwards to operator new and checks every buffer comes back with its size
+ * and alignment.
+ */
+class TrackingResource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0;
+
+  std::size_t Outstanding() const { return live_.size(); }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    live_[p] = {bytes, alignment};
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    const auto it = live_.find(p);
+    EXPECT_NE(it, live_.end());
+    EXPECT_EQ(it->second.first, bytes);
+    EXPECT_EQ(it->second.second, alignment);
+    live_.erase(it);
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  std::map<void*, std::pair<std::size_t, std::size_t>> live_;
+};
+
+void Fill(S21::S21Matrix& matrix) {
+  for (int i = 0; i < matrix.GetRows(); ++i) {
+    for (int j = 0; j < matrix.GetCols(); ++j) {
+      matrix(i, j) = (i + 1) * (j + 2) % 7 + (i == j ? 10 : 0);
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * TEST for which matrices take their buffers from a resource.
+ */
+TEST(s21_resource_tests, propagation) {
+  TrackingResource resource;
+  {
+    S21::S21Matrix a(6, 6, &resource);
+    Fill(a);
+    EXPECT_EQ(a.GetResource(), &resource);
+    EXPECT_EQ(resource.allocations, 1);
+
+    // Results computed from a come from its resource
+    S21::S21Matrix product = a * a;
+    S21::S21Matrix transposed = a.Transpose();
+    S21::S21Matrix inverse = a.InverseMatrix();
+    EXPECT_EQ(product.GetResource(), &resource);
+    EXPECT_EQ(transposed.GetResource(), &resource);
+    EXPECT_EQ(inverse.GetResource(), &resource);
+
+    // A plain copy does not, a copy assignment keeps the target's resource
+    S21::S21Matrix copy = a;
+    EXPECT_NE(copy.GetResource(), &resource);
+    S21::S21Matrix target(&resource);
+    target = copy;
+    EXPECT_EQ(target.GetResource(), &resource);
+    EXPECT_TRUE(target == a);
+
+    // A move takes the buffer with its resource
+    S21::S21Matrix moved(std::move(product));
+    EXPECT_EQ(moved.GetResource(), &resource);
+
+    target.Reserve(20, 9);
+    target.AppendRow(target.RowSpan(0));
+    target.SetCols(3);
+    target.ShrinkToFit();
+    target.TransposeInPlace();
+    EXPECT_EQ(target.GetResource(), &resource);
+    EXPECT_EQ(target.GetRows(), 3);
+    EXPECT_EQ(target(2, 6), a(0, 2));
+    EXPECT_EQ(a.Determinant(), copy.Determinant());
+  }
+  EXPECT_EQ(resource.Outstanding(), 0u);
+}
+
+/**
+ * TEST for expressions assigned to a matrix living in an arena.
+ */
+TEST(s21_resource_tests, expressions_in_arena) {
+  TrackingResource upstream;
+  {
+    std::pmr::monotonic_buffer_resource tracked_arena(&upstream);
+    S21::S21Matrix a(5, 5, &tracked_arena), b(5, 5, &tracked_arena);
+    Fill(a);
+    Fill(b);
+    S21::S21Matrix sum(&tracked_arena);
+    sum = a + b * 2.0;
+    EXPECT_EQ(sum.GetResource(), &tracked_arena);
+    EXPECT_EQ(sum(1, 2), a(1, 2) * 3);
+    sum = a * b + a;
+    EXPECT_EQ(sum.GetResource(), &tracked_arena);
+    EXPECT_GT(upstream.allocations, 0);
+  }
+  EXPECT_EQ(upstream.Outstanding(), 0u);
+
+  // Small matrices stay inline and never touch the resource
+  TrackingResource unused;
+  S21::S21Matrix small(4, 4, &unused);
+  small.SetRows(2);
+  S21::S21Matrix small_product = small * small.Transpose();
+  EXPECT_EQ(unused.allocations, 0);
+  EXPECT_EQ(small_product.GetRows(), 2);
+}
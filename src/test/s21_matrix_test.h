@@ -1,12 +1,91 @@
-// Copyright 2024 Dmitrii Khramtsov
-
-#ifndef CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
-#define CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
-
-#include <gtest/gtest.h>
-
-#include <stdexcept>
-
-#include "../s21_matrix_oop.h"
-
-#endif  // CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
+// Copyright 2024 Dmitrii Khramtsov
+
+#ifndef CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
+#define CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_kernels.h"
+#include "../s21_matrix_oop.h"
+
+namespace S21 {
+namespace test {
+
+template <class T>
+struct WaveElement {
+  static T At(int i, int j, double phase) {
+    return static_cast<T>(std::sin(i * 1.3 + j * 0.7 + phase));
+  }
+};
+
+template <class R>
+struct WaveElement<std::complex<R>> {
+  static std::complex<R> At(int i, int j, double phase) {
+    return {WaveElement<R>::At(i, j, phase),
+            static_cast<R>(std::cos(i * 0.4 - j * 1.1 + phase))};
+  }
+};
+
+/**
+ * Deterministic element of the test matrices, in [-1, 1]; complex ones get
+ * an imaginary part of another frequency.
+ */
+template <class T>
+T WaveAt(int i, int j, double phase = 0.0) {
+  return WaveElement<T>::At(i, j, phase);
+}
+
+/**
+ * rows x cols matrix of WaveAt() elements. The real ones have rank 2 at most,
+ * the complex ones rank 4.
+ */
+template <class T>
+BasicMatrix<T> Wave(int rows, int cols, double phase = 0.0) {
+  BasicMatrix<T> matrix(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      matrix(i, j) = WaveAt<T>(i, j, phase);
+    }
+  }
+  return matrix;
+}
+
+/**
+ * Largest absolute difference of the elements of two matrices of one size.
+ */
+template <class T>
+double MaxDiff(const BasicMatrix<T>& a, const BasicMatrix<T>& b) {
+  double diff = 0.0;
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) {
+      diff = std::max(diff, static_cast<double>(std::abs(a(i, j) - b(i, j))));
+    }
+  }
+  return diff;
+}
+
+/**
+ * Returns the kernel tables of T this host can run, the portable one first.
+ */
+template <class T>
+std::vector<const internal::BasicKernelTable<T>*> AvailableKernels() {
+  std::vector<const internal::BasicKernelTable<T>*> tables;
+  for (internal::SimdLevel level :
+       {internal::SimdLevel::kScalar, internal::SimdLevel::kSse2,
+        internal::SimdLevel::kAvx2, internal::SimdLevel::kAvx512}) {
+    const auto* table = internal::KernelsFor<T>(level);
+    if (table) tables.push_back(table);
+  }
+  return tables;
+}
+
+}  // namespace test
+}  // namespace S21
+
+#endif  // CPP1_S21_MATRIXPLUS_TEST_S21_MATRIX_TEST_OOP_H_
@@ -0,0 +1,204 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_sparse_matrix.h"
+#include "../s21_thread_pool.h"
+#include "s21_matrix_test.h"
+
+namespace {
+
+/**
+ * Dense rows x cols matrix in which about one element in every stride is
+ * non-zero, at pseudo-random positions.
+ */
+S21::S21Matrix Scattered(int rows, int cols, int stride, unsigned seed) {
+  S21::S21Matrix matrix(rows, cols);
+  unsigned state = seed * 2654435761u + 1;
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      state = state * 1664525u + 1013904223u;
+      if ((state >> 8) % stride == 0) {
+        matrix(i, j) = S21::test::WaveAt<double>(i, j) + 2.0;
+      }
+    }
+  }
+  return matrix;
+}
+
+using S21::test::MaxDiff;
+
+}  // namespace
+
+/**
+ * TEST for building a matrix from unordered triplets with duplicates.
+ */
+TEST(s21_sparse_tests, triplets) {
+  S21::S21SparseMatrix matrix(3, 4, {{2, 3, 1.0},
+                                     {0, 2, 5.0},
+                                     {0, 1, 2.0},
+                                     {0, 2, -1.0},
+                                     {1, 0, 3.0},
+                                     {1, 0, -3.0}});
+  EXPECT_EQ(matrix.GetRows(), 3);
+  EXPECT_EQ(matrix.GetCols(), 4);
+  EXPECT_EQ(matrix.GetNonZeros(), 3);
+  EXPECT_EQ(matrix.GetRowPtr(), (std::vector<int>{0, 2, 2, 3}));
+  EXPECT_EQ(matrix.GetColIndex(), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(matrix.GetValues(), (std::vector<double>{2.0, 4.0, 1.0}));
+  EXPECT_DOUBLE_EQ(matrix(0, 2), 4.0);
+  EXPECT_DOUBLE_EQ(matrix(1, 0), 0.0);
+  EXPECT_DOUBLE_EQ(matrix(2, 2), 0.0);
+  EXPECT_THROW(matrix(3, 0), std::out_of_range);
+  EXPECT_THROW(S21::S21SparseMatrix(2, 2, {{2, 0, 1.0}}), std::out_of_range);
+  EXPECT_THROW(S21::S21SparseMatrix(-1, 2), std::invalid_argument);
+}
+
+/**
+ * TEST for validating ready CSR arrays.
+ */
+TEST(s21_sparse_tests, csr_arrays) {
+  S21::S21SparseMatrix matrix(2, 3, {0, 1, 3}, {2, 0, 1}, {1.0, 2.0, 0.0});
+  EXPECT_EQ(matrix.GetNonZeros(), 3);
+  EXPECT_DOUBLE_EQ(matrix(0, 2), 1.0);
+  EXPECT_THROW(S21::S21SparseMatrix(2, 3, {0, 1}, {0}, {1.0}),
+               std::invalid_argument);
+  EXPECT_THROW(S21::S21SparseMatrix(2, 3, {0, 2, 2}, {1, 1}, {1.0, 2.0}),
+               std::invalid_argument);
+  EXPECT_THROW(S21::S21SparseMatrix(2, 3, {0, 1, 1}, {3}, {1.0}),
+               std::invalid_argument);
+  EXPECT_THROW(S21::S21SparseMatrix(2, 3, {0, 2, 1}, {0}, {1.0}),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for the conversions to and from dense matrices and CSC arrays.
+ */
+TEST(s21_sparse_tests, conversions) {
+  const S21::S21Matrix dense = {{0, 1, 0}, {2, 0, 3}};
+  const S21::S21SparseMatrix sparse(dense);
+  EXPECT_EQ(sparse.GetNonZeros(), 3);
+  EXPECT_TRUE(sparse.ToDense() == dense);
+
+  const S21::S21Csc csc = sparse.ToCsc();
+  EXPECT_EQ(csc.rows, 2);
+  EXPECT_EQ(csc.cols, 3);
+  EXPECT_EQ(csc.col_ptr, (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(csc.row_index, (std::vector<int>{1, 0, 1}));
+  EXPECT_EQ(csc.values, (std::vector<double>{2, 1, 3}));
+  EXPECT_TRUE(S21::S21SparseMatrix(csc).ToDense() == dense);
+
+  const S21::S21SparseMatrix empty;
+  EXPECT_EQ(empty.GetRows(), 0);
+  EXPECT_EQ(empty.GetNonZeros(), 0);
+}
+
+/**
+ * TEST for the transpose.
+ */
+TEST(s21_sparse_tests, transpose) {
+  const S21::S21Matrix dense = Scattered(37, 23, 5, 1);
+  const S21::S21SparseMatrix transposed =
+      S21::S21SparseMatrix(dense).Transpose();
+  EXPECT_TRUE(transposed.ToDense() == dense.Transpose());
+}
+
+/**
+ * TEST for the sparse matrix-vector product.
+ */
+TEST(s21_sparse_tests, mul_vector) {
+  const S21::S21Matrix dense = Scattered(53, 41, 4, 2);
+  const S21::S21SparseMatrix sparse(dense);
+  std::vector<double> x(41);
+  S21::S21Matrix column(41, 1);
+  for (int j = 0; j < 41; ++j) {
+    x[j] = column(j, 0) = std::cos(j * 0.3);
+  }
+  const std::vector<double> y = sparse * x;
+  const S21::S21Matrix expected = dense * column;
+  ASSERT_EQ(y.size(), 53u);
+  for (int i = 0; i < 53; ++i) {
+    EXPECT_NEAR(y[i], expected(i, 0), 1e-12);
+  }
+  EXPECT_THROW(sparse.MulVector(std::vector<double>(40)),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for sparse times dense and dense times sparse products, split across
+ * threads.
+ */
+TEST(s21_sparse_tests, mul_dense) {
+  const int threads = S21::GetNumThreads();
+  S21::SetNumThreads(4);
+  const S21::S21Matrix a = Scattered(301, 203, 10, 3);
+  const S21::S21Matrix b = Scattered(203, 97, 1, 4);
+  const S21::S21SparseMatrix sparse(a);
+  EXPECT_LT(MaxDiff(sparse * b, a * b), 1e-12);
+
+  const S21::S21Matrix c = Scattered(89, 301, 1, 5);
+  EXPECT_LT(MaxDiff(c * sparse, c * a), 1e-12);
+  S21::SetNumThreads(threads);
+
+  EXPECT_THROW(sparse * c, std::invalid_argument);
+  EXPECT_THROW(b * sparse, std::invalid_argument);
+}
+
+/**
+ * TEST for sums and differences of sparse matrices.
+ */
+TEST(s21_sparse_tests, sum_sub) {
+  const S21::S21Matrix a = Scattered(64, 48, 3, 6);
+  const S21::S21Matrix b = Scattered(64, 48, 3, 7);
+  S21::S21SparseMatrix sum(a);
+  sum += S21::S21SparseMatrix(b);
+  EXPECT_TRUE(sum.ToDense() == a + b);
+  S21::S21SparseMatrix difference(a);
+  difference.SubMatrix(S21::S21SparseMatrix(b));
+  EXPECT_TRUE(difference.ToDense() == a - b);
+
+  const S21::S21SparseMatrix sparse(a);
+  EXPECT_EQ((sparse - sparse).GetNonZeros(), 0);
+  EXPECT_THROW(sparse + S21::S21SparseMatrix(48, 64), std::invalid_argument);
+  EXPECT_THROW(sparse - S21::S21SparseMatrix(48, 64), std::invalid_argument);
+}
+
+/**
+ * TEST for a sum split across threads whose right operand holds nearly all
+ * the non-zeros.
+ */
+TEST(s21_sparse_tests, sum_lopsided) {
+  const int threads = S21::GetNumThreads();
+  S21::SetNumThreads(4);
+  const S21::S21Matrix a = Scattered(400, 200, 5000, 8);
+  const S21::S21Matrix b = Scattered(400, 200, 1, 9);
+  const S21::S21SparseMatrix sparse_a(a), sparse_b(b);
+  EXPECT_TRUE((sparse_a + sparse_b).ToDense() == a + b);
+  EXPECT_TRUE((sparse_b - sparse_a).ToDense() == b - a);
+  S21::SetNumThreads(threads);
+}
+
+/**
+ * TEST for multiplying by a number.
+ */
+TEST(s21_sparse_tests, mul_number) {
+  S21::S21SparseMatrix matrix(2, 2, {{0, 1, 3.0}, {1, 0, -1.0}});
+  matrix.MulNumber(2.0);
+  EXPECT_EQ(matrix.GetValues(), (std::vector<double>{6.0, -2.0}));
+  matrix.MulNumber(0.0);
+  EXPECT_EQ(matrix.GetNonZeros(), 0);
+  EXPECT_EQ(matrix.GetRowPtr(), (std::vector<int>{0, 0, 0}));
+}
+
+/**
+ * TEST for exact integer products.
+ */
+TEST(s21_sparse_tests, integer) {
+  const S21::BasicMatrix<int> dense = {{0, 2, 0}, {1, 0, -1}, {0, 0, 3}};
+  const S21::BasicSparseMatrix<int> sparse(dense);
+  EXPECT_TRUE(sparse * dense == dense * dense);
+  EXPECT_TRUE(dense * sparse == dense * dense);
+  const std::vector<int> x = {1, 2, 3};
+  EXPECT_EQ(sparse * x, (std::vector<int>{4, -2, 9}));
+}
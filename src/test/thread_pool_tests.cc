@@ -0,0 +1,77 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include <atomic>
+#include <vector>
+
+#include "../s21_thread_pool.h"
+#include "s21_matrix_test.h"
+
+/**
+ * TEST for running every index of a ParallelFor exactly once.
+ */
+TEST(s21_thread_pool_tests, parallel_for_covers_range) {
+  S21::ThreadPool pool(4);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.ParallelFor(1000, [&hits](int i) { hits[i].fetch_add(1); });
+  for (const auto& hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+/**
+ * TEST for a ParallelFor started from inside a pool task.
+ */
+TEST(s21_thread_pool_tests, nested_parallel_for) {
+  S21::ThreadPool pool(3);
+  std::atomic<int> sum{0};
+  pool.ParallelFor(8, [&](int) {
+    pool.ParallelFor(8, [&](int j) { sum.fetch_add(j); });
+  });
+  EXPECT_EQ(sum.load(), 8 * 28);
+}
+
+/**
+ * TEST for propagating an exception thrown by a task to the caller.
+ */
+TEST(s21_thread_pool_tests, exception_propagates) {
+  S21::ThreadPool pool(2);
+  EXPECT_THROW(pool.ParallelFor(16,
+                                [](int i) {
+                                  if (i == 7) throw std::out_of_range("task");
+                                }),
+               std::out_of_range);
+}
+
+/**
+ * TEST for rejecting a pool without threads.
+ */
+TEST(s21_thread_pool_tests, invalid_size) {
+  EXPECT_THROW(S21::ThreadPool(0), std::invalid_argument);
+  EXPECT_THROW(S21::SetNumThreads(0), std::invalid_argument);
+}
+
+/**
+ * TEST for the parallel product matching the single-threaded one.
+ */
+TEST(s21_thread_pool_tests, parallel_gemm_matches_serial) {
+  S21::S21Matrix a(301, 257);
+  S21::S21Matrix b(257, 289);
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) {
+      a(i, j) = (i * 7 + j * 3) % 11 - 5.0;
+    }
+  }
+  for (int i = 0; i < b.GetRows(); ++i) {
+    for (int j = 0; j < b.GetCols(); ++j) {
+      b(i, j) = (i * 5 + j * 13) % 9 - 4.0;
+    }
+  }
+  const int threads = S21::GetNumThreads();
+  S21::SetNumThreads(1);
+  S21::S21Matrix serial = a * b;
+  S21::SetNumThreads(4);
+  EXPECT_EQ(S21::GetNumThreads(), 4);
+  S21::S21Matrix parallel = a * b;
+  S21::SetNumThreads(threads);
+  EXPECT_TRUE(parallel == serial);
+}
@@ -0,0 +1,97 @@
+// Copyright 2024 Dmitrii Khramtsov
+
+#include "s21_matrix_test.h"
+
+namespace {
+
+S21::S21Matrix Sequence(int rows, int cols) {
+  S21::S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      matrix(i, j) = i * cols + j;
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+/**
+ * TEST for blocks, rows, columns and transposed windows sharing elements.
+ */
+TEST(s21_view_tests, slicing) {
+  S21::S21Matrix matrix = Sequence(4, 5);
+  S21::S21MatrixView block = matrix.Block(1, 2, 2, 3);
+  EXPECT_EQ(block.GetRows(), 2);
+  EXPECT_EQ(block(0, 0), 7);
+  EXPECT_EQ(block.Row(1)(0, 2), 14);
+  EXPECT_EQ(block.Col(1)(1, 0), 13);
+  EXPECT_EQ(block.Transpose()(2, 1), 14);
+
+  block(1, 1) = -1;
+  EXPECT_EQ(matrix(2, 3), -1);
+  block.Transpose().At(0, 1) = -2;
+  EXPECT_EQ(matrix(2, 2), -2);
+
+  const S21::S21Matrix copy(block.Transpose());
+  const S21::S21Matrix expected = {{7, -2}, {8, -1}, {9, 14}};
+  EXPECT_TRUE(S21::S21Matrix(copy) == expected);
+  EXPECT_TRUE(copy.View().EqMatrix(block.Transpose()));
+
+  EXPECT_THROW(matrix.Block(3, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(block.Row(2), std::out_of_range);
+  EXPECT_THROW(block(0, 3), std::out_of_range);
+}
+
+/**
+ * TEST for element-wise operations on views, including overlapping ones.
+ */
+TEST(s21_view_tests, arithmetic) {
+  S21::S21Matrix matrix = Sequence(3, 3);
+  matrix.SumMatrix(matrix.View().Transpose());
+  S21::S21Matrix expected = {{0, 4, 8}, {4, 8, 12}, {8, 12, 16}};
+  EXPECT_TRUE(matrix == expected);
+
+  matrix.Block(0, 0, 2, 2).SubMatrix(matrix.Block(1, 1, 2, 2));
+  expected = {{-8, -8, 8}, {-8, -8, 12}, {8, 12, 16}};
+  EXPECT_TRUE(matrix == expected);
+
+  matrix.View().Col(2).MulNumber(0.5);
+  matrix.View().Row(2).Assign(matrix.View().Col(0).Transpose());
+  expected = {{-8, -8, 4}, {-8, -8, 6}, {-8, -8, 8}};
+  EXPECT_TRUE(matrix == expected);
+
+  EXPECT_THROW(matrix.SumMatrix(matrix.Block(0, 0, 2, 2)),
+               std::invalid_argument);
+  EXPECT_THROW(matrix.Block(0, 0, 1, 3).Assign(matrix.View().Col(0)),
+               std::invalid_argument);
+}
+
+/**
+ * TEST for products and determinants of views.
+ */
+TEST(s21_view_tests, products) {
+  const S21::S21Matrix a = {{2, 5, 7, 0}, {6, 3, 4, 1}, {5, -2, -3, 2}};
+  EXPECT_EQ(a.Block(0, 0, 3, 3).Determinant(), -1);
+  const S21::S21Matrix inverse = a.Block(0, 0, 3, 3).InverseMatrix();
+  const S21::S21Matrix expected = {
+      {1, -1, 1}, {-38, 41, -34}, {27, -29, 24}};
+  EXPECT_TRUE(S21::S21Matrix(inverse) == expected);
+
+  const S21::S21Matrix b = Sequence(4, 2);
+  const S21::S21Matrix product = a * b;
+  S21::S21Matrix left(a.Block(0, 0, 3, 2));
+  left *= b.Block(0, 0, 2, 2);
+  EXPECT_EQ(left(2, 1), 5 * 1 - 2 * 3);
+  left += left.View();
+  left -= product.Block(0, 0, 3, 2);
+  EXPECT_EQ(left(2, 1), 2 * (5 * 1 - 2 * 3) - product(2, 1));
+
+  S21::S21Matrix transposed = a * S21::S21Matrix(b.View().Transpose())
+                                      .View()
+                                      .Transpose();
+  EXPECT_TRUE(transposed == product);
+  S21::S21Matrix square(a.Block(0, 0, 3, 3));
+  square.MulMatrix(square.View().Transpose());
+  EXPECT_EQ(square(0, 1), 2 * 6 + 5 * 3 + 7 * 4);
+}